@@ -47,6 +47,13 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <mutex>
+#include <array>
+#include <span>
+#include <bit>
 
 // Includes LLVM files (disables warnings thrown by them) //
 
@@ -60,6 +67,20 @@
 #include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/Module.h>
 #include <llvm/IR/Verifier.h>
+#include <llvm/IR/CFG.h>
+#include <llvm/IR/ValueHandle.h>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/Linker/Linker.h>
+#include <llvm/IRReader/IRReader.h>
+#include <llvm/IR/LegacyPassManager.h>
+#include <llvm/Support/SourceMgr.h>
+#include <llvm/Support/TargetSelect.h>
+#include <llvm/Support/Host.h>
+#include <llvm/MC/TargetRegistry.h>
+#include <llvm/Target/TargetMachine.h>
+#include <llvm/Target/TargetOptions.h>
+#include <llvm/Transforms/Utils/SplitModule.h>
 
 #pragma warning(pop) // <- Renables all warnings
 
@@ -81,6 +102,11 @@ namespace LX
 // Includes the rest of common //
 
 #include <inc/Error.h>
+#include <inc/Trace.h>
 #include <inc/Logger.h>
 #include <inc/ThrowIf.h>
 #include <inc/IO.h>
+#include <inc/SourceFile.h>
+#include <inc/Parallel.h>
+#include <inc/Memory.h>
+#include <inc/Profiler.h>
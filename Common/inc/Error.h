@@ -38,6 +38,26 @@ namespace LX
 		// The location of the file (used for console output) //
 		const char* fileLocation;
 	};
+
+	// Error thrown when the tokens of a source hold more memory than allowed (only checked when allocations are tracked) //
+	struct COMMON_API TokenMemoryExceeded : public RuntimeError
+	{
+		// Constructor to set the values (no others provided) //
+		TokenMemoryExceeded(int64_t _held, size_t _sourceBytes, double _bound);
+
+		// Prints the error to the console //
+		void PrintToConsole() const;
+
+		// Returns the error as c-string //
+		const char* ErrorType() const;
+
+		// The bytes held by the tokens and how large the source was //
+		int64_t held;
+		size_t sourceBytes;
+
+		// The most bytes that were allowed for each byte of the source //
+		double bound;
+	};
 }
 
 // Helper macro to autogenerate a basic error type in a .h file //
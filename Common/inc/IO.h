@@ -59,20 +59,11 @@ namespace LX
 		return contents;
 	}
 
-	// Util function for getting a line of the source at a given index (used for errors) //
-	inline std::string GetLineAtIndexOf(const std::string& src, const std::streamsize index) // <- Has to be inline because of C++ types
+	// Util function for getting the amount of characters in a UTF-8 string (used for errors) //
+	inline size_t CountCodePoints(std::string_view str)
 	{
-		// Finds the start of the line //
-		size_t start = src.rfind('\n', index);
-		if (start == std::string::npos) { start = 0; } // None means first line
-		else { start = start + 1; } // Skips new line char
-
-		// Finds the end of the line //
-		size_t end = src.find('\n', index);
-		if (end == std::string::npos) { end = src.size(); } // None means last line
-
-		// Returns the string between start and end //
-		return src.substr(start, end - start);
+		// Every byte that is not a continuation byte is the start of a character //
+		return std::count_if(str.begin(), str.end(), [](char c) { return ((unsigned char)c & 0xC0) != 0x80; });
 	}
 
 	// Util function for turning a a char to a string. Used to stop '\t' being printed as a tab //
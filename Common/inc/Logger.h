@@ -1,6 +1,39 @@
+// The lowest priority of log compiled into the program, logs below it compile to nothing //
+// 0 removes all logging, 1 keeps only high priority logs and 2 keeps all of them //
+#ifndef LX_LOG_LEVEL
+	#ifdef NDEBUG
+		#define LX_LOG_LEVEL 1
+	#else
+		#define LX_LOG_LEVEL 2
+	#endif // NDEBUG
+#endif // LX_LOG_LEVEL
+
+// Set to 1 to write the log as a binary trace (log.trace) instead of text, see Trace.h //
+#ifndef LX_LOG_TRACE
+	#define LX_LOG_TRACE 0
+#endif // LX_LOG_TRACE
+
+// Logs the args with the priority (HIGH or LOW), the args are only evaluated if the log is compiled in and enabled //
+// Logs that are not compiled in do not evaluate their args so they cost nothing, calling Log::out directly would still evaluate them //
+#define LX_LOG(priority, ...) LX_LOG_FORMAT(priority, AUTO, __VA_ARGS__)
+
+// Same as LX_LOG but with the format of the log (AUTO or NONE) //
+#define LX_LOG_FORMAT(priority, format, ...) do { \
+	if constexpr (LX::Log::IsCompiled(LX::Log::Priority::priority)) { \
+		if (LX::Log::IsEnabled<LX::Log::Priority::priority>()) { LX::Log::out<LX::Log::Priority::priority, LX::Log::Format::format>(__VA_ARGS__); } \
+	} \
+} while (false)
+
+// Adds a named break to the log, the args are only evaluated if high priority logs are compiled in //
+#define LX_LOG_SECTION(...) do { \
+	if constexpr (LX::Log::IsCompiled(LX::Log::Priority::HIGH)) { LX::Log::LogNewSection(__VA_ARGS__); } \
+} while (false)
+
 namespace LX
 {
 	// Static class used for logging information //
+	// Records are formatted on the thread that logs them and written to the file by a background thread //
+	// This makes it safe to log from multiple threads, each record is written whole //
 	class COMMON_API Log
 	{
 		public:
@@ -25,56 +58,123 @@ namespace LX
 				LOW // Default
 			};
 
+			// If the log is written as a binary trace instead of text //
+			static constexpr bool TRACING = (LX_LOG_TRACE != 0);
+
+			// If logs of the priority are compiled into the program //
+			static constexpr bool IsCompiled(Priority priority)
+			{
+				return LX_LOG_LEVEL > (int)priority;
+			}
+
+			// If logs of the priority are written to the log //
+			// Used to skip work that is only done for the log, is always false if they are not compiled //
+			template<Priority priority>
+			static bool IsEnabled()
+			{
+				if constexpr (IsCompiled(priority) == false) { return false; }
+				else if constexpr (priority == Priority::LOW) { return s_Priority == Priority::LOW; }
+				else { return true; }
+			}
+
 			// Variadic template to allow an undefined ammount of arguments //
 			template<Priority priority = Priority::LOW, Format format = Format::AUTO, typename... Args>
 				requires AllLogable<Args...> // <- Checks all types can be outputted to the console
 
 			// Logs information (if the log is initalised) //
-			static void out(Args... args)
+			// The args are only formatted if the priority is high enough, use LX_LOG so they are not evaluated either //
+			static void out(const Args&... args)
 			{
-				// Returns if not high enough priority //
-				if constexpr (priority == Priority::LOW)
+				// Compiles to nothing if the priority is not compiled in //
+				if constexpr (IsCompiled(priority))
 				{
-					RETURN_IF(s_Priority == Priority::HIGH);
-				}
+					// Returns if not high enough priority //
+					RETURN_IF(IsEnabled<priority>() == false);
 
-				// Prints out the args ending with a new line unless specified //
-				if constexpr (format == Format::AUTO) { ((*s_LogFile << ... << args) << "\n"); }
+					// Prints out the args ending with a new line unless specified //
+					std::ostream& record = BeginRecord();
+					if constexpr (format == Format::AUTO) { ((record << ... << args) << "\n"); }
 
-				// Else prints out the args as provided //
-				else { (*s_LogFile << ... << args); }
+					// Else prints out the args as provided //
+					else { (record << ... << args); }
 
-				// Flushes the log (only if debugger is attached) //
-				// Only flushes then as that is when the log is monitered during the process //
-				if (IsDebuggerPresent()) { s_LogFile->flush(); }
+					EndRecord();
+				}
 			}
 
 			// Variadic template to allow an undefined ammount of arguments //
 			template<typename... Args>
 				requires AllLogable<Args...> // <- Checks all types can be outputted to the console
 
-			// Adds a named break between different sections in the log //
-			static void LogNewSection(Args... args)
+			// Adds a named break between different sections in the log (use LX_LOG_SECTION) //
+			static void LogNewSection(const Args&... args)
 			{
-				// Constant for how a break is represented in the log //
-				static const char* BREAK = "-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-";
+				if constexpr (IsCompiled(Priority::HIGH))
+				{
+					// Constant for how a break is represented in the log //
+					static const char* BREAK = "-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-";
 
-				// Outputs the arguments between two breaks //
-				*s_LogFile << '\n' << BREAK << '\n';
-				(*s_LogFile << ... << args);
-				*s_LogFile << '\n' << BREAK << '\n';
+					// Outputs the arguments between two breaks //
+					std::ostream& record = BeginRecord();
+					record << '\n' << BREAK << '\n';
+					(record << ... << args);
+					record << '\n' << BREAK << '\n';
 
-				// Flushes the log (only if debugger is attached) //
-				// Only flushes then as that is when the log is monitered during the process //
-				if (IsDebuggerPresent()) { s_LogFile->flush(); }
+					EndRecord();
+				}
 			}
 
-			// Initalises the log //
+			// Records the event into the binary trace (if the log is a trace and the priority is high enough) //
+			template<Priority priority>
+			static void Event(const TraceEvent& event)
+			{
+				if constexpr (TRACING && IsCompiled(priority))
+				{
+					RETURN_IF(IsEnabled<priority>() == false);
+					Trace::Record(event);
+				}
+			}
+
+			// Records the event with the string into the binary trace (if the log is a trace and the priority is high enough) //
+			template<Priority priority>
+			static void Event(TraceEvent event, std::string_view string)
+			{
+				if constexpr (TRACING && IsCompiled(priority))
+				{
+					RETURN_IF(IsEnabled<priority>() == false);
+					Trace::Record(event, string);
+				}
+			}
+
+			// The most tabs a line of the log can be indented by //
+			static constexpr unsigned MAX_INDENT = 64;
+
+			// Returns the indentation of the depth (without allocating) //
+			// Stops growing past a point so very deep trees do not make the size of the log grow quadratically //
+			static std::string_view Indent(unsigned depth)
+			{
+				static const std::string tabs(MAX_INDENT, '\t');
+				return std::string_view(tabs).substr(0, std::min(depth, MAX_INDENT));
+			}
+
+			// Initalises the log (closing it first if it was already open) //
+			// Anything logged before it is initalised is thrown away //
 			static void Init(Priority _default);
 
+			// Waits until everything that has been logged is written to the file //
+			// Called automatically if the program crashes //
+			static void Flush();
+
+			// Writes anything left to the file and stops the background thread //
+			// Has to be called before the program exits, at exit the log is only written if the background thread is not writing //
+			static void Close();
+
 		private:
-			// Keeps the pointer hidden to stop accidental changes //
-			static std::ofstream* s_LogFile;
+			// Returns the stream for the calling thread to format a record into (starts empty) //
+			static std::ostream& BeginRecord();
+
+			// Passes the record formatted by the calling thread to the background thread //
+			static void EndRecord();
 
 			// The current priority of the log output //
 			static Priority s_Priority;
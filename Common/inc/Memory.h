@@ -0,0 +1,96 @@
+// Set to 1 to count every allocation made by the compiler, tagged by the phase it was made in //
+// The counts are added to the compile report (see Profiler.h) //
+#ifndef LX_TRACK_MEMORY
+	#define LX_TRACK_MEMORY 0
+#endif // LX_TRACK_MEMORY
+
+// The most bytes the tokens of a source can hold for each byte of the source when allocations are tracked //
+// Compiling fails with TokenMemoryExceeded if the lexer goes over it, so a change that makes tokens larger is noticed //
+#ifndef LX_TOKEN_BYTES_PER_SOURCE_BYTE
+	#define LX_TOKEN_BYTES_PER_SOURCE_BYTE 8
+#endif // LX_TOKEN_BYTES_PER_SOURCE_BYTE
+
+namespace LX
+{
+	// The memory used by a phase of compiling //
+	struct MemoryPhase
+	{
+		// The name of the phase //
+		const char* name = nullptr;
+
+		// How many bytes were allocated during the phase and in how many allocations //
+		uint64_t allocated = 0;
+		uint64_t allocations = 0;
+
+		// How many bytes the allocations made during the phase still held when the next phase began //
+		int64_t liveAtEnd = 0;
+
+		// How many bytes the allocations made during the phase still hold //
+		int64_t live = 0;
+
+		// The most bytes that were held at once during the phase (including allocations made before it) //
+		int64_t peak = 0;
+	};
+
+	// Static class that counts the allocations made by the compiler //
+	// The allocations are passed to it by replacing operator new and delete (see MemoryHooks.cpp) //
+	// Allocations cannot allocate themselves so everything is stored in fixed size arrays //
+	class COMMON_API MemoryTracker
+	{
+		public:
+			// This class should never be constructed //
+			// It acts like a fancy namespace //
+			MemoryTracker() = delete;
+
+			// If allocations are being counted, set with LX_TRACK_MEMORY //
+			static constexpr bool ENABLED = (LX_TRACK_MEMORY != 0);
+
+			// The most phases that can be counted at once, any more are counted as part of the last one //
+			static constexpr size_t MAX_PHASES = 16;
+
+			// The most bytes the tokens can hold for each byte of the source (see LX_TOKEN_BYTES_PER_SOURCE_BYTE) //
+			static constexpr double TOKEN_BYTES_PER_SOURCE_BYTE = LX_TOKEN_BYTES_PER_SOURCE_BYTE;
+
+			// Sources smaller than this are not checked as the fixed size tables of the lexer are most of what they hold //
+			static constexpr size_t MIN_CHECKED_SOURCE = 64 * 1024;
+
+			// Information stored before every allocation so it can be counted when it is freed //
+			struct alignas(16) Header
+			{
+				// The size requested by the allocation //
+				uint64_t size;
+
+				// The phase the allocation was made in and which reset it was made after //
+				uint16_t phase;
+				uint16_t generation;
+
+				// How far the start of the allocation is before the header //
+				uint32_t offset;
+			};
+
+			// Throws away all the phases, allocations made before are no longer counted as part of any phase //
+			static void Reset();
+
+			// Starts counting allocations as part of the phase, the name must live as long as the program //
+			static void BeginPhase(const char* name);
+
+			// Counts an allocation, filling in the header with the phase it was made in //
+			static void Allocated(Header& header);
+
+			// Counts an allocation being freed //
+			static void Freed(const Header& header);
+
+			// Returns the bytes currently allocated by the whole program //
+			static int64_t Live();
+
+			// Returns how many phases have been counted since the last reset //
+			static size_t PhaseCount();
+
+			// Returns a copy of the counts of a phase //
+			static MemoryPhase Phase(size_t index);
+
+			// Throws TokenMemoryExceeded if the current phase holds more than the bound for each byte of the source //
+			// Called at the end of lexing, does nothing if allocations are not tracked //
+			static void CheckTokenMemory(size_t sourceBytes);
+	};
+}
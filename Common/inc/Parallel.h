@@ -0,0 +1,31 @@
+namespace LX
+{
+	// Calls the function with every index from 0 up to count, spread over the given amount of threads //
+	// The calling thread does work as well, so a single thread means everything is done in order on it //
+	// The function must not throw as there is nothing to catch it on the worker threads //
+	template<typename Func>
+	inline void ParallelFor(size_t count, unsigned threads, Func func)
+	{
+		// Each thread takes the next index that has not been started yet //
+		// Stops threads being left idle when some indecies take longer than others //
+		std::atomic<size_t> next = 0;
+
+		auto worker = [&]()
+		{
+			for (size_t i = next++; i < count; i = next++)
+			{
+				func(i);
+			}
+		};
+
+		// Starts the extra threads (never more than there are indecies) //
+		std::vector<std::jthread> workers;
+		for (size_t i = 1; i < std::min<size_t>(threads, count); i++)
+		{
+			workers.emplace_back(worker);
+		}
+
+		// The calling thread joins in and then waits for the rest when the workers are destroyed //
+		worker();
+	}
+}
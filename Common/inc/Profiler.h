@@ -0,0 +1,147 @@
+namespace LX
+{
+	// Measures the time since it was created (or last restarted) //
+	class Timer
+	{
+		public:
+			// Starts the timer //
+			Timer()
+				: m_Start(std::chrono::steady_clock::now())
+			{}
+
+			// Returns the nanoseconds since the timer was started //
+			inline uint64_t Elapsed() const
+			{
+				return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_Start).count();
+			}
+
+			// Returns the nanoseconds since the timer was started and starts it again //
+			inline uint64_t Restart()
+			{
+				const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+				const uint64_t elapsed = (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_Start).count();
+
+				m_Start = now;
+				return elapsed;
+			}
+
+		private:
+			std::chrono::steady_clock::time_point m_Start;
+	};
+
+	// How long the parts of generating a function took //
+	struct FunctionProfile
+	{
+		// The name of the function, only a view as it is copied by the profiler //
+		// Passing a std::string between the DLLs would free it with a different operator delete when allocations are tracked //
+		std::string_view name;
+
+		// Nanoseconds spent creating the IR and then verifying it //
+		uint64_t buildTime = 0;
+		uint64_t verifyTime = 0;
+
+		// How much the function contained //
+		size_t nodes = 0;
+		size_t instructions = 0;
+	};
+
+	// Static class that collects how long each phase of compiling took //
+	// Written as a JSON report so compile time can be tracked between builds //
+	// Can also record a timeline of when each part started and ended on each thread, written in the Chrome trace-event format //
+	class COMMON_API Profiler
+	{
+		public:
+			// This class should never be constructed //
+			// It acts like a fancy namespace //
+			Profiler() = delete;
+
+			// Throws away anything recorded and sets what should be recorded next //
+			static void Begin(bool report, bool timeline);
+
+			// If timings are being recorded, used to skip work that is only done for the report //
+			static bool IsEnabled();
+
+			// If the timeline is being recorded, inline so checking it is only a load and a branch //
+			inline static bool IsTracing() { return s_Tracing.load(std::memory_order_relaxed); }
+
+			// --- Everything below does nothing if the profiler is not enabled --- //
+
+			// Adds how long a phase took, phases are reported in the order they are added //
+			static void AddPhase(std::string_view name, uint64_t nanoseconds);
+
+			// Adds to a count of something within the input (such as tokens) //
+			static void AddCount(std::string_view name, uint64_t count);
+
+			// Adds the timings of a function, functions are reported in the order they are added //
+			// The name is copied so it only has to live until this returns //
+			static void AddFunction(const FunctionProfile& profile);
+
+			// Writes everything recorded to a JSON file //
+			// When built with LX_TRACK_MEMORY the memory used by each phase is added as well //
+			static void WriteReport(const std::filesystem::path& path);
+
+			// --- Everything below does nothing if the timeline is not being recorded --- //
+
+			// Adds the start ('B') or end ('E') of a part of the timeline on the calling thread //
+			// Each thread records into its own buffer so no locks are taken (apart from the first time a thread records) //
+			// The name and detail are not copied so must outlive the call to WriteTimeline //
+			static void AddEvent(char phase, const char* name, std::string_view detail = {});
+
+			// Writes the timeline to a JSON file that can be opened by chrome://tracing or Perfetto //
+			// Must not be called whilst other threads are still recording //
+			static void WriteTimeline(const std::filesystem::path& path);
+
+		private:
+			// If the timeline is being recorded //
+			static std::atomic<bool> s_Tracing;
+	};
+
+	// Times from when it is created until it is destroyed then adds it as a phase //
+	class ScopedTimer
+	{
+		public:
+			// Starts timing the phase, the name must outlive the timer //
+			ScopedTimer(const char* phase)
+				: m_Phase(phase)
+			{}
+
+			// Adds the phase to the profiler //
+			~ScopedTimer()
+			{
+				Profiler::AddPhase(m_Phase, m_Timer.Elapsed());
+			}
+
+			ScopedTimer(const ScopedTimer&) = delete;
+			ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+		private:
+			const char* m_Phase;
+			Timer m_Timer;
+	};
+
+	// Adds a part of the timeline that starts when it is created and ends when it is destroyed //
+	// Costs a single branch if the timeline is not being recorded //
+	class ScopedEvent
+	{
+		public:
+			// Starts the part of the timeline, the name and detail must outlive the timeline being written //
+			ScopedEvent(const char* name, std::string_view detail = {})
+				: m_Recorded(Profiler::IsTracing())
+			{
+				if (m_Recorded) { Profiler::AddEvent('B', name, detail); }
+			}
+
+			// Ends the part of the timeline //
+			~ScopedEvent()
+			{
+				if (m_Recorded) { Profiler::AddEvent('E', nullptr); }
+			}
+
+			ScopedEvent(const ScopedEvent&) = delete;
+			ScopedEvent& operator=(const ScopedEvent&) = delete;
+
+		private:
+			// If the start was recorded, stops an end being added without a start //
+			const bool m_Recorded;
+	};
+}
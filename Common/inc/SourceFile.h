@@ -0,0 +1,37 @@
+namespace LX
+{
+	// Read-only contents of a file that is mapped into memory instead of being copied //
+	// Anything viewing into the contents must not outlive the object //
+	class COMMON_API SourceFile
+	{
+		public:
+			// Opens the file and maps it into memory //
+			// Falls back to reading the file if it can not be mapped (such as pipes) //
+			SourceFile(const std::filesystem::path& path, const std::string& errorName = "input file path");
+
+			// Unmaps the file or frees the memory it was read into //
+			~SourceFile();
+
+			// Copying would unmap the file twice //
+			SourceFile(const SourceFile&) = delete;
+			SourceFile& operator=(const SourceFile&) = delete;
+
+			// Returns a view of the whole file //
+			inline std::string_view View() const { return std::string_view(m_Data, m_Length); }
+
+		private:
+			// The contents of the file and its length //
+			// Stored as raw pointers because of how DLLs work //
+
+			const char* m_Data = nullptr;
+			size_t m_Length = 0;
+
+			// Handles to the file and its mapping, left as nullptr if the file was read instead //
+
+			HANDLE m_File = nullptr;
+			HANDLE m_Mapping = nullptr;
+
+			// The memory the file was read into if it could not be mapped //
+			char* m_Buffer = nullptr;
+	};
+}
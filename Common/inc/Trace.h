@@ -0,0 +1,81 @@
+namespace LX
+{
+	// The types of events within a binary trace //
+	// lx-trace turns each one back into the text that would have been logged //
+	enum class TraceEventType : uint8_t
+	{
+		// Text logged by Log::out or Log::LogNewSection, the string is the text //
+		TEXT,
+
+		// The source of a file being lexed, the string is the source //
+		SOURCE,
+
+		// A token within the last source, kind is its type //
+		// a is its index within the tokens and b is its index within the source (high bits) and its length (low bits) //
+		TOKEN,
+
+		// --- Nodes of the AST, depth is how far they are indented --- //
+
+		NUMBER_INTEGER, // <- b is the value
+		NUMBER_DECIMAL, // <- b is the bits of the value
+		OPERATION, // <- kind is the operand
+		OPERATION_RHS, // <- The start of the right side of an operation
+		RETURN_STATEMENT,
+		VARIABLE_DECLARATION, // <- The string is the name
+		VARIABLE_ASSIGNMENT, // <- The string is the name
+		VARIABLE_ACCESS, // <- The string is the name
+		FUNCTION_CALL, // <- The string is the name, kind is if it has any args
+
+		// A node that IR is being generated for, kind is its type //
+		GENERATING_NODE
+	};
+
+	// A fixed size event within a binary trace, what the members mean depends on the type //
+	// Events with a string hold where it is within the strings of the trace (a is the length and b the offset) //
+	struct TraceEvent
+	{
+		TraceEventType type;
+		uint8_t kind;
+		uint16_t depth;
+		uint32_t a;
+		uint64_t b;
+	};
+
+	// A binary trace read back from a file //
+	struct TraceFile
+	{
+		// The events in the order they were recorded //
+		std::vector<TraceEvent> events;
+
+		// The strings of all the events one after another //
+		std::string strings;
+
+		// Returns the string of an event that has one //
+		inline std::string_view StringOf(const TraceEvent& event) const { return std::string_view(strings).substr(event.b, event.a); }
+	};
+
+	// Static class that records the events of a binary trace into memory //
+	// Used by the log when it is built with LX_LOG_TRACE, so formatting the text is left to lx-trace //
+	class COMMON_API Trace
+	{
+		public:
+			// This class should never be constructed //
+			// It acts like a fancy namespace //
+			Trace() = delete;
+
+			// Throws away every event that has been recorded //
+			static void Clear();
+
+			// Adds the event to the end of the trace //
+			static void Record(const TraceEvent& event);
+
+			// Adds the event to the end of the trace with its string //
+			static void Record(TraceEvent event, std::string_view string);
+
+			// Writes the whole trace to the file in one go //
+			static void Write(const std::filesystem::path& path);
+
+			// Reads a trace created by Write //
+			static TraceFile Read(const std::filesystem::path& path);
+	};
+}
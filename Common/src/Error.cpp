@@ -44,4 +44,22 @@ namespace LX
 	{
 		return "Invalid File Path";
 	}
+
+	TokenMemoryExceeded::TokenMemoryExceeded(int64_t _held, size_t _sourceBytes, double _bound)
+		: held(_held), sourceBytes(_sourceBytes), bound(_bound)
+	{}
+
+	void TokenMemoryExceeded::PrintToConsole() const
+	{
+		// Tells the user how far over the bound the tokens were //
+		LX::PrintAsColor<Color::LIGHT_RED>("Error: ");
+		std::cout << "The tokens held " << held << " bytes for a source of " << sourceBytes << " bytes (";
+		LX::PrintAsColor<Color::WHITE>((double)held / (double)sourceBytes);
+		std::cout << " bytes per source byte, the bound is " << bound << ")\n\nThe bound can be changed with LX_TOKEN_BYTES_PER_SOURCE_BYTE\n";
+	}
+
+	const char* TokenMemoryExceeded::ErrorType() const
+	{
+		return "Token Memory Exceeded";
+	}
 }
@@ -2,22 +2,349 @@
 
 namespace LX
 {
-	// Allocates memory for the log file pointer //
+	// Allocates memory for the log priority //
 
-	std::ofstream* Log::s_LogFile = nullptr;
 	Log::Priority Log::s_Priority;
 
+	// --- Log ring buffer --- //
+	// Records are copied into the slots of a ring buffer that the background thread reads in order //
+	// A record claims all the slots it needs at once so records from different threads are never mixed together //
+	// Each slot has a sequence number to tell if it is empty or filled for the current pass around the ring //
+
+	// How much text each slot can hold, longer records take up multiple slots //
+	static constexpr size_t LOG_SLOT_TEXT = 116;
+
+	// How many slots are within the ring (has to be a power of 2) //
+	static constexpr size_t LOG_SLOT_COUNT = 1 << 13;
+
+	// The most slots a record can claim at once, longer records are passed in parts (which can be split up by other threads) //
+	static constexpr size_t LOG_MAX_CLAIM = 256;
+
+	// How much text the background thread collects before writing it to the file //
+	static constexpr size_t LOG_WRITE_SIZE = 1 << 16;
+
+	struct alignas(64) LogSlot
+	{
+		// Equal to the position of the slot when it is empty and one past it when it is filled //
+		std::atomic<size_t> sequence;
+
+		// How much of the text is used //
+		uint32_t length;
+
+		char text[LOG_SLOT_TEXT];
+	};
+
+	static LogSlot s_Slots[LOG_SLOT_COUNT];
+
+	// The next position to be claimed by a thread logging //
+	static std::atomic<size_t> s_Head = 0;
+
+	// The next position to be read by the background thread (only used by it) //
+	static size_t s_Tail = 0;
+
+	// Everything before this position has been written to the file //
+	static std::atomic<size_t> s_Written = 0;
+
+	// Set when the background thread is waiting for records to be logged //
+	static std::atomic<bool> s_Sleeping = false;
+
+	// Tells the background thread to stop once everything has been written //
+	static std::atomic<bool> s_Stopping = false;
+
+	// If the log has been initalised (and not closed) //
+	static std::atomic<bool> s_Running = false;
+
+	static std::ofstream s_LogFile;
+	static std::thread s_Writer;
+
+	// Held whilst writing records to the file so the exit handler never writes at the same time as the background thread //
+	static std::mutex s_WriteLock;
+
+	// Wakes the background thread if it is waiting for records //
+	static void WakeWriter()
+	{
+		if (s_Sleeping.exchange(false))
+		{
+			s_Sleeping.notify_one();
+		}
+	}
+
+	// Copies the record into the ring buffer //
+	static void PushRecord(std::string_view record)
+	{
+		while (record.empty() == false)
+		{
+			// Claims the slots of the record //
+			const size_t slots = std::min((record.length() + LOG_SLOT_TEXT - 1) / LOG_SLOT_TEXT, LOG_MAX_CLAIM);
+			const size_t first = s_Head.fetch_add(slots);
+
+			// Wakes the background thread before filling the slots as it may need to empty them first //
+			WakeWriter();
+
+			for (size_t i = 0; i < slots; i++)
+			{
+				// Waits for the slot to be emptied if the ring is full //
+				LogSlot& slot = s_Slots[(first + i) & (LOG_SLOT_COUNT - 1)];
+				while (slot.sequence.load(std::memory_order_acquire) != first + i)
+				{
+					std::this_thread::yield();
+				}
+
+				// Fills the slot and marks it as filled //
+				const size_t length = std::min(record.length(), LOG_SLOT_TEXT);
+				std::memcpy(slot.text, record.data(), length);
+				slot.length = (uint32_t)length;
+				slot.sequence.store(first + i + 1, std::memory_order_release);
+
+				record.remove_prefix(length);
+			}
+		}
+	}
+
+	// Collects the filled slots in order and writes them to the file //
+	// Returns false if there was nothing to write //
+	static bool WriteRecords(std::string& buffer)
+	{
+		while (buffer.length() < LOG_WRITE_SIZE)
+		{
+			// Stops at the first slot that has not been filled //
+			LogSlot& slot = s_Slots[s_Tail & (LOG_SLOT_COUNT - 1)];
+			if (slot.sequence.load(std::memory_order_acquire) != s_Tail + 1) { break; }
+
+			// Empties the slot for the next pass around the ring //
+			buffer.append(slot.text, slot.length);
+			slot.sequence.store(s_Tail + LOG_SLOT_COUNT, std::memory_order_release);
+			s_Tail++;
+		}
+
+		RETURN_V_IF(false, buffer.empty());
+
+		// Writes the records in one go and lets any threads waiting for them know //
+		// Flushed every time so the log can be watched while the program runs //
+		s_LogFile.write(buffer.data(), buffer.length());
+		s_LogFile.flush();
+		buffer.clear();
+
+		s_Written.store(s_Tail);
+		s_Written.notify_all();
+		return true;
+	}
+
+	// The function run by the background thread //
+	static void WriteLog()
+	{
+		std::string buffer;
+		buffer.reserve(LOG_WRITE_SIZE + LOG_SLOT_TEXT);
+
+		while (true)
+		{
+			bool wrote = false;
+			{
+				std::scoped_lock lock(s_WriteLock);
+				wrote = WriteRecords(buffer);
+			}
+
+			RETURN_IF(wrote == false && s_Tail == s_Head.load() && s_Stopping.load());
+
+			// Keeps going if a record is still being copied in //
+			if (s_Tail != s_Head.load())
+			{
+				std::this_thread::yield();
+				continue;
+			}
+
+			// Else waits for a thread to log something (checking nothing was logged after it last checked) //
+			s_Sleeping.store(true);
+			if (s_Tail == s_Head.load() && s_Stopping.load() == false)
+			{
+				s_Sleeping.wait(true);
+			}
+
+			s_Sleeping.store(false);
+		}
+	}
+
+	// Called when the program exits with the log still open, the log should normally be closed before then //
+	// Within a DLL this runs whilst the loader lock is held so the background thread cannot be joined (it may have already been ended) //
+	// Instead it is told to stop and whatever is left is written on this thread //
+	static void CloseOnExit()
+	{
+		RETURN_IF(s_Running.exchange(false) == false);
+
+		// A binary trace is written in one go //
+		if constexpr (Log::TRACING)
+		{
+			Trace::Write("log.trace");
+			return;
+		}
+
+		s_Stopping.store(true);
+		WakeWriter();
+
+		// The background thread is left to end on its own //
+		if (s_Writer.joinable()) { s_Writer.detach(); }
+
+		// Nothing is written if the background thread was ended part way through writing as the records could be in any state //
+		std::unique_lock lock(s_WriteLock, std::try_to_lock);
+		RETURN_IF(lock.owns_lock() == false);
+
+		std::string buffer;
+		while (WriteRecords(buffer)) {}
+	}
+
+	// Flushes the log before passing the crash on to whatever handled it before //
+	static std::terminate_handler s_PreviousTerminate = nullptr;
+	static LPTOP_LEVEL_EXCEPTION_FILTER s_PreviousFilter = nullptr;
+
+	static LONG WINAPI FlushOnException(EXCEPTION_POINTERS* exception)
+	{
+		Log::Flush();
+		return (s_PreviousFilter != nullptr) ? s_PreviousFilter(exception) : EXCEPTION_CONTINUE_SEARCH;
+	}
+
+	static void FlushOnTerminate()
+	{
+		Log::Flush();
+		if (s_PreviousTerminate != nullptr) { s_PreviousTerminate(); }
+		std::abort();
+	}
+
 	void Log::Init(Priority _default)
 	{
-		// The actual object holding the log file //
-		// Has to be done like this to stop MSVC complaining //
-		static std::ofstream actualLog;
+		// Closes the log if it was already open //
+		Close();
 
-		// Opens the log file and assigns it to the log pointer //
-		actualLog.open("log.txt");
-		s_LogFile = &actualLog;
+		// Adds the hooks to write the log when the program exits or crashes //
+		static std::once_flag hooksAdded;
+		std::call_once(hooksAdded, []()
+		{
+			std::atexit(CloseOnExit);
+			s_PreviousTerminate = std::set_terminate(FlushOnTerminate);
+			s_PreviousFilter = SetUnhandledExceptionFilter(FlushOnException);
+		});
 
 		// Assigns the priority //
 		s_Priority = _default;
+
+		// A binary trace is kept in memory until it is written //
+		if constexpr (TRACING)
+		{
+			Trace::Clear();
+			s_Running.store(true);
+			return;
+		}
+
+		// Opens the log file //
+		s_LogFile.open("log.txt");
+
+		// Resets the ring buffer (there is no background thread yet so it is only used by this thread) //
+		s_Head.store(0);
+		s_Tail = 0;
+		s_Written.store(0);
+		s_Stopping.store(false);
+
+		for (size_t i = 0; i < LOG_SLOT_COUNT; i++)
+		{
+			s_Slots[i].sequence.store(i, std::memory_order_relaxed);
+		}
+
+		// Starts the background thread //
+		s_Writer = std::thread(WriteLog);
+		s_Running.store(true);
+	}
+
+	void Log::Flush()
+	{
+		RETURN_IF(s_Running.load() == false);
+
+		// A binary trace is written in one go //
+		if constexpr (TRACING)
+		{
+			Trace::Write("log.trace");
+			return;
+		}
+
+		// The background thread cannot wait on itself (if it crashed) //
+		RETURN_IF(std::this_thread::get_id() == s_Writer.get_id());
+
+		// Waits for everything that has been logged to be written //
+		const size_t target = s_Head.load();
+		WakeWriter();
+
+		for (size_t written = s_Written.load(); written < target; written = s_Written.load())
+		{
+			s_Written.wait(written);
+		}
+	}
+
+	void Log::Close()
+	{
+		RETURN_IF(s_Running.exchange(false) == false);
+
+		// A binary trace is written in one go //
+		if constexpr (TRACING)
+		{
+			Trace::Write("log.trace");
+			return;
+		}
+
+		// Tells the background thread to write what is left and waits for it to finish //
+		s_Stopping.store(true);
+		WakeWriter();
+
+		if (s_Writer.joinable()) { s_Writer.join(); }
+
+		// Writes anything the background thread missed (if it was stopped by the program exiting) //
+		std::string buffer;
+		while (WriteRecords(buffer)) {}
+
+		s_LogFile.close();
+	}
+
+	// --- Formatting records --- //
+
+	// Stream buffer that formats into a string which keeps its memory between records //
+	class RecordBuffer : public std::streambuf
+	{
+		public:
+			std::string text;
+
+		protected:
+			int_type overflow(int_type c) override
+			{
+				if (c != traits_type::eof()) { text.push_back((char)c); }
+				return c;
+			}
+
+			std::streamsize xsputn(const char* s, std::streamsize count) override
+			{
+				text.append(s, (size_t)count);
+				return count;
+			}
+	};
+
+	// Each thread formats its records into its own stream //
+	struct RecordStream
+	{
+		RecordBuffer buffer;
+		std::ostream stream{ &buffer };
+	};
+
+	static thread_local RecordStream s_Record;
+
+	std::ostream& Log::BeginRecord()
+	{
+		s_Record.buffer.text.clear();
+		return s_Record.stream;
+	}
+
+	void Log::EndRecord()
+	{
+		// Anything logged before the log is initalised is thrown away //
+		RETURN_IF(s_Running.load(std::memory_order_relaxed) == false);
+
+		// When writing a binary trace the text is kept as it is //
+		if constexpr (TRACING) { Trace::Record({ TraceEventType::TEXT }, s_Record.buffer.text); }
+		else { PushRecord(s_Record.buffer.text); }
 	}
 }
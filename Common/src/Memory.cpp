@@ -0,0 +1,127 @@
+#include <LX-Common.h>
+
+namespace LX
+{
+	// The counts of each phase, atomic as any thread can allocate //
+	struct PhaseCounters
+	{
+		const char* name = nullptr;
+
+		std::atomic<uint64_t> allocated = 0;
+		std::atomic<uint64_t> allocations = 0;
+		std::atomic<int64_t> liveAtEnd = 0;
+		std::atomic<int64_t> live = 0;
+		std::atomic<int64_t> peak = 0;
+	};
+
+	static PhaseCounters s_Phases[MemoryTracker::MAX_PHASES];
+
+	// The phase allocations are currently counted as part of //
+	static std::atomic<size_t> s_PhaseCount = 0;
+	static std::atomic<size_t> s_CurrentPhase = 0;
+
+	// Increased on every reset so allocations from before it are not taken away from the new phases when they are freed //
+	static std::atomic<uint16_t> s_Generation = 0;
+
+	// The bytes allocated by the whole program //
+	static std::atomic<int64_t> s_Live = 0;
+
+	// Raises the value to at least the given one //
+	static void RaiseTo(std::atomic<int64_t>& value, int64_t target)
+	{
+		int64_t current = value.load(std::memory_order_relaxed);
+		while (current < target && value.compare_exchange_weak(current, target, std::memory_order_relaxed) == false) {}
+	}
+
+	void MemoryTracker::Reset()
+	{
+		s_PhaseCount.store(0);
+		s_CurrentPhase.store(0);
+		s_Generation.fetch_add(1);
+	}
+
+	void MemoryTracker::BeginPhase(const char* name)
+	{
+		const size_t count = s_PhaseCount.load();
+
+		// Stores what the last phase still holds //
+		if (count != 0)
+		{
+			PhaseCounters& last = s_Phases[count - 1];
+			last.liveAtEnd.store(last.live.load());
+		}
+
+		// Anything past the last phase is counted as part of it //
+		RETURN_IF(count == MAX_PHASES);
+
+		PhaseCounters& phase = s_Phases[count];
+		phase.name = name;
+		phase.allocated.store(0);
+		phase.allocations.store(0);
+		phase.liveAtEnd.store(0);
+		phase.live.store(0);
+		phase.peak.store(s_Live.load());
+
+		s_CurrentPhase.store(count);
+		s_PhaseCount.store(count + 1);
+	}
+
+	void MemoryTracker::Allocated(Header& header)
+	{
+		const int64_t live = s_Live.fetch_add((int64_t)header.size, std::memory_order_relaxed) + (int64_t)header.size;
+
+		header.generation = s_Generation.load(std::memory_order_relaxed);
+		header.phase = UINT16_MAX;
+
+		// Allocations before the first phase are not counted as part of any //
+		RETURN_IF(s_PhaseCount.load(std::memory_order_relaxed) == 0);
+
+		const size_t index = s_CurrentPhase.load(std::memory_order_relaxed);
+		PhaseCounters& phase = s_Phases[index];
+
+		header.phase = (uint16_t)index;
+		phase.allocated.fetch_add(header.size, std::memory_order_relaxed);
+		phase.allocations.fetch_add(1, std::memory_order_relaxed);
+		phase.live.fetch_add((int64_t)header.size, std::memory_order_relaxed);
+		RaiseTo(phase.peak, live);
+	}
+
+	void MemoryTracker::Freed(const Header& header)
+	{
+		s_Live.fetch_sub((int64_t)header.size, std::memory_order_relaxed);
+
+		// Only takes it away from its phase if it was made after the last reset //
+		RETURN_IF(header.phase == UINT16_MAX || header.generation != s_Generation.load(std::memory_order_relaxed));
+		s_Phases[header.phase].live.fetch_sub((int64_t)header.size, std::memory_order_relaxed);
+	}
+
+	int64_t MemoryTracker::Live()
+	{
+		return s_Live.load();
+	}
+
+	size_t MemoryTracker::PhaseCount()
+	{
+		return s_PhaseCount.load();
+	}
+
+	MemoryPhase MemoryTracker::Phase(size_t index)
+	{
+		const PhaseCounters& phase = s_Phases[index];
+
+		// The current phase has not ended so what it holds at the end is what it holds now //
+		const int64_t live = phase.live.load();
+		const int64_t liveAtEnd = (index + 1 == s_PhaseCount.load()) ? live : phase.liveAtEnd.load();
+
+		return { phase.name, phase.allocated.load(), phase.allocations.load(), liveAtEnd, live, phase.peak.load() };
+	}
+
+	void MemoryTracker::CheckTokenMemory(size_t sourceBytes)
+	{
+		RETURN_IF(ENABLED == false || sourceBytes < MIN_CHECKED_SOURCE || s_PhaseCount.load() == 0);
+
+		// What the phase holds now is what it holds at its end as it is called as the phase ends //
+		const int64_t held = s_Phases[s_CurrentPhase.load()].live.load();
+		ThrowIf<TokenMemoryExceeded>((double)held > TOKEN_BYTES_PER_SOURCE_BYTE * (double)sourceBytes, held, sourceBytes, TOKEN_BYTES_PER_SOURCE_BYTE);
+	}
+}
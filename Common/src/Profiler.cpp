@@ -0,0 +1,251 @@
+#include <LX-Common.h>
+
+namespace LX
+{
+	// Everything that has been recorded (only accessed with the lock) //
+	// Functions can be generated on multiple threads so they are all added under it //
+	static std::mutex s_ProfileLock;
+	static std::vector<std::pair<std::string, uint64_t>> s_Phases;
+	static std::vector<std::pair<std::string, uint64_t>> s_Counts;
+	// The names are copied so everything is owned by this DLL (even when allocations are tracked within the other) //
+	static std::vector<std::pair<std::string, FunctionProfile>> s_Functions;
+
+	static std::atomic<bool> s_Enabled = false;
+
+	// Allocates memory for if the timeline is being recorded //
+	std::atomic<bool> Profiler::s_Tracing = false;
+
+	// --- Timeline --- //
+	// Each thread has its own buffer of events so recording an event never takes a lock //
+	// The buffers are owned here (not by the threads) so events are not lost when a thread exits //
+
+	struct TimelineEvent
+	{
+		const char* name;
+		std::string_view detail;
+
+		// Nanoseconds since the timeline began //
+		uint64_t time;
+
+		// 'B' for the start of a part and 'E' for the end //
+		char phase;
+	};
+
+	struct ThreadTimeline
+	{
+		// The ID the thread is shown with in the timeline, given in the order the threads first recorded //
+		uint32_t id;
+
+		std::vector<TimelineEvent> events;
+	};
+
+	// The buffers of every thread that has recorded (only accessed with the lock) //
+	static std::vector<std::unique_ptr<ThreadTimeline>> s_Timelines;
+
+	// Increased every time the timeline begins so threads know their buffer is from an old timeline //
+	static std::atomic<uint32_t> s_TimelineGeneration = 0;
+
+	// When the timeline began //
+	static Timer s_TimelineClock;
+
+	// The buffer of the calling thread and which timeline it is for //
+	static thread_local ThreadTimeline* s_ThreadTimeline = nullptr;
+	static thread_local uint32_t s_ThreadGeneration = 0;
+
+	// Writes the string with anything JSON does not allow escaped //
+	static void WriteJSONString(std::ostream& out, std::string_view string)
+	{
+		out << '"';
+
+		for (char c : string)
+		{
+			if (c == '"' || c == '\\') { out << '\\' << c; }
+			else if ((unsigned char)c < 0x20) { out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << (int)c << std::dec << std::setfill(' '); }
+			else { out << c; }
+		}
+
+		out << '"';
+	}
+
+	void Profiler::Begin(bool report, bool timeline)
+	{
+		std::scoped_lock lock(s_ProfileLock);
+
+		s_Phases.clear();
+		s_Counts.clear();
+		s_Functions.clear();
+
+		// Any buffers threads still point to are left alone until they are told they are out of date //
+		s_Timelines.clear();
+		s_TimelineGeneration.fetch_add(1, std::memory_order_release);
+		s_TimelineClock.Restart();
+
+		s_Enabled.store(report);
+		s_Tracing.store(timeline);
+	}
+
+	bool Profiler::IsEnabled()
+	{
+		return s_Enabled.load(std::memory_order_relaxed);
+	}
+
+	void Profiler::AddPhase(std::string_view name, uint64_t nanoseconds)
+	{
+		RETURN_IF(IsEnabled() == false);
+
+		std::scoped_lock lock(s_ProfileLock);
+		s_Phases.emplace_back(name, nanoseconds);
+	}
+
+	void Profiler::AddCount(std::string_view name, uint64_t count)
+	{
+		RETURN_IF(IsEnabled() == false);
+
+		std::scoped_lock lock(s_ProfileLock);
+
+		// Adds to the count if it already exists //
+		for (auto& [countName, total] : s_Counts)
+		{
+			if (countName == name)
+			{
+				total = total + count;
+				return;
+			}
+		}
+
+		s_Counts.emplace_back(name, count);
+	}
+
+	void Profiler::AddFunction(const FunctionProfile& profile)
+	{
+		RETURN_IF(IsEnabled() == false);
+
+		std::scoped_lock lock(s_ProfileLock);
+		s_Functions.emplace_back(profile.name, profile);
+	}
+
+	void Profiler::WriteReport(const std::filesystem::path& path)
+	{
+		std::scoped_lock lock(s_ProfileLock);
+
+		std::ofstream file(path);
+		ThrowIf<InvalidFilePath>(file.is_open() == false, "report file path", path);
+
+		// All times are in nanoseconds //
+		file << "{\n\t\"phases\": [";
+
+		for (size_t i = 0; i < s_Phases.size(); i++)
+		{
+			file << (i == 0 ? "\n" : ",\n") << "\t\t{ \"name\": ";
+			WriteJSONString(file, s_Phases[i].first);
+			file << ", \"ns\": " << s_Phases[i].second << " }";
+		}
+
+		file << "\n\t],\n\t\"counts\": {";
+
+		for (size_t i = 0; i < s_Counts.size(); i++)
+		{
+			file << (i == 0 ? "\n\t\t" : ",\n\t\t");
+			WriteJSONString(file, s_Counts[i].first);
+			file << ": " << s_Counts[i].second;
+		}
+
+		file << "\n\t},\n\t\"functions\": [";
+
+		for (size_t i = 0; i < s_Functions.size(); i++)
+		{
+			const FunctionProfile& func = s_Functions[i].second;
+
+			file << (i == 0 ? "\n" : ",\n") << "\t\t{ \"name\": ";
+			WriteJSONString(file, s_Functions[i].first);
+			file << ", \"build_ns\": " << func.buildTime << ", \"verify_ns\": " << func.verifyTime;
+			file << ", \"nodes\": " << func.nodes << ", \"instructions\": " << func.instructions << " }";
+		}
+
+		file << "\n\t]";
+
+		// Adds the memory used by each phase when built to count allocations (all in bytes) //
+		if constexpr (MemoryTracker::ENABLED)
+		{
+			file << ",\n\t\"memory\": {\n\t\t\"live\": " << MemoryTracker::Live() << ",\n\t\t\"phases\": [";
+
+			for (size_t i = 0; i < MemoryTracker::PhaseCount(); i++)
+			{
+				const MemoryPhase phase = MemoryTracker::Phase(i);
+
+				file << (i == 0 ? "\n" : ",\n") << "\t\t\t{ \"name\": ";
+				WriteJSONString(file, phase.name);
+				file << ", \"allocated\": " << phase.allocated << ", \"allocations\": " << phase.allocations;
+				file << ", \"live_at_end\": " << phase.liveAtEnd << ", \"live\": " << phase.live << ", \"peak\": " << phase.peak << " }";
+			}
+
+			file << "\n\t\t]\n\t}";
+		}
+
+		file << "\n}\n";
+	}
+
+	void Profiler::AddEvent(char phase, const char* name, std::string_view detail)
+	{
+		RETURN_IF(IsTracing() == false);
+		const uint64_t time = s_TimelineClock.Elapsed();
+
+		// Creates the buffer of the thread the first time it records within this timeline //
+		const uint32_t generation = s_TimelineGeneration.load(std::memory_order_acquire);
+		if (s_ThreadTimeline == nullptr || s_ThreadGeneration != generation)
+		{
+			std::scoped_lock lock(s_ProfileLock);
+
+			s_ThreadTimeline = s_Timelines.emplace_back(std::make_unique<ThreadTimeline>()).get();
+			s_ThreadTimeline->id = (uint32_t)s_Timelines.size();
+			s_ThreadGeneration = generation;
+		}
+
+		s_ThreadTimeline->events.push_back({ name, detail, time, phase });
+	}
+
+	void Profiler::WriteTimeline(const std::filesystem::path& path)
+	{
+		std::scoped_lock lock(s_ProfileLock);
+
+		std::ofstream file(path);
+		ThrowIf<InvalidFilePath>(file.is_open() == false, "timeline file path", path);
+
+		// Times within the file are in microseconds //
+		file << "{\n\t\"displayTimeUnit\": \"ns\",\n\t\"traceEvents\": [";
+		file << std::fixed << std::setprecision(3);
+
+		bool first = true;
+		for (const std::unique_ptr<ThreadTimeline>& thread : s_Timelines)
+		{
+			// Names the thread, the first to record is the one that started compiling //
+			const std::string threadName = (thread->id == 1) ? "Main" : "Worker " + std::to_string(thread->id - 1);
+
+			file << (first ? "\n" : ",\n") << "\t\t{ \"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << thread->id;
+			file << ", \"args\": { \"name\": \"" << threadName << "\" } }";
+			first = false;
+
+			for (const TimelineEvent& event : thread->events)
+			{
+				file << ",\n\t\t{ \"ph\": \"" << event.phase << "\", \"ts\": " << (double)event.time / 1000.0 << ", \"pid\": 1, \"tid\": " << thread->id;
+
+				if (event.name != nullptr)
+				{
+					file << ", \"name\": ";
+					WriteJSONString(file, event.name);
+				}
+
+				if (event.detail.empty() == false)
+				{
+					file << ", \"args\": { \"name\": ";
+					WriteJSONString(file, event.detail);
+					file << " }";
+				}
+
+				file << " }";
+			}
+		}
+
+		file << "\n\t]\n}\n";
+	}
+}
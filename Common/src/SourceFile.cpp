@@ -0,0 +1,78 @@
+#include <LX-Common.h>
+
+namespace LX
+{
+	SourceFile::SourceFile(const std::filesystem::path& path, const std::string& errorName)
+	{
+		// Opens the file, failing means the path is invalid or the process does not have access //
+		m_File = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		ThrowIf<LX::InvalidFilePath>(m_File == INVALID_HANDLE_VALUE, errorName, path);
+
+		// Files on disk are mapped into memory //
+		if (GetFileType(m_File) == FILE_TYPE_DISK)
+		{
+			// Empty files can not be mapped so are left with an empty view //
+			LARGE_INTEGER size = {};
+			if (GetFileSizeEx(m_File, &size) && size.QuadPart == 0)
+			{
+				return;
+			}
+
+			// Maps the whole file as read-only //
+			m_Mapping = CreateFileMappingW(m_File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			const void* view = m_Mapping != nullptr ? MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+
+			// Assigns the contents if the mapping worked //
+			if (view != nullptr)
+			{
+				m_Data = static_cast<const char*>(view);
+				m_Length = static_cast<size_t>(size.QuadPart);
+				return;
+			}
+
+			// Else cleans up the mapping and reads the file instead //
+			if (m_Mapping != nullptr) { CloseHandle(m_Mapping); }
+			m_Mapping = nullptr;
+		}
+
+		// Pipes and other files that can not be mapped are read until there is nothing left //
+		// The size is not known up front so the buffer doubles in size each time it runs out of space //
+
+		size_t capacity = 0x10000;
+		m_Buffer = new char[capacity];
+
+		DWORD read = 0;
+		while (ReadFile(m_File, m_Buffer + m_Length, static_cast<DWORD>(std::min<size_t>(capacity - m_Length, MAXDWORD)), &read, nullptr) && read != 0)
+		{
+			m_Length = m_Length + read;
+
+			// Moves the contents to a bigger buffer if it is full //
+			if (m_Length == capacity)
+			{
+				char* bigger = new char[capacity * 2];
+				std::memcpy(bigger, m_Buffer, m_Length);
+				delete[] m_Buffer;
+
+				m_Buffer = bigger;
+				capacity = capacity * 2;
+			}
+		}
+
+		m_Data = m_Buffer;
+	}
+
+	SourceFile::~SourceFile()
+	{
+		// Unmaps the view before closing the handles it came from //
+		if (m_Mapping != nullptr)
+		{
+			UnmapViewOfFile(m_Data);
+			CloseHandle(m_Mapping);
+		}
+
+		// Frees the buffer if the file was read instead //
+		delete[] m_Buffer;
+
+		CloseHandle(m_File);
+	}
+}
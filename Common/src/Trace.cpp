@@ -0,0 +1,88 @@
+#include <LX-Common.h>
+
+namespace LX
+{
+	// The start of every trace file //
+	struct TraceHeader
+	{
+		char magic[4];
+		uint32_t version;
+		uint64_t eventCount;
+		uint64_t stringLength;
+	};
+
+	static constexpr char TRACE_MAGIC[4] = { 'L', 'X', 'T', 'R' };
+
+	// Changed whenever the events change so old traces are not read wrong //
+	static constexpr uint32_t TRACE_VERSION = 1;
+
+	// The events and their strings (only accessed with the lock) //
+	static std::mutex s_TraceLock;
+	static std::vector<TraceEvent> s_Events;
+	static std::string s_Strings;
+
+	void Trace::Clear()
+	{
+		std::scoped_lock lock(s_TraceLock);
+		s_Events.clear();
+		s_Strings.clear();
+	}
+
+	void Trace::Record(const TraceEvent& event)
+	{
+		std::scoped_lock lock(s_TraceLock);
+		s_Events.push_back(event);
+	}
+
+	void Trace::Record(TraceEvent event, std::string_view string)
+	{
+		std::scoped_lock lock(s_TraceLock);
+
+		// Stores where the string is within the trace //
+		event.a = (uint32_t)string.length();
+		event.b = s_Strings.length();
+
+		s_Strings.append(string);
+		s_Events.push_back(event);
+	}
+
+	void Trace::Write(const std::filesystem::path& path)
+	{
+		std::scoped_lock lock(s_TraceLock);
+
+		// Puts the whole trace in one buffer so it can be written in one go //
+		const TraceHeader header = { { TRACE_MAGIC[0], TRACE_MAGIC[1], TRACE_MAGIC[2], TRACE_MAGIC[3] }, TRACE_VERSION, s_Events.size(), s_Strings.length() };
+		const size_t eventBytes = s_Events.size() * sizeof(TraceEvent);
+
+		std::string buffer(sizeof(TraceHeader) + eventBytes + s_Strings.length(), '\0');
+		std::memcpy(buffer.data(), &header, sizeof(TraceHeader));
+		std::memcpy(buffer.data() + sizeof(TraceHeader), s_Events.data(), eventBytes);
+		std::memcpy(buffer.data() + sizeof(TraceHeader) + eventBytes, s_Strings.data(), s_Strings.length());
+
+		std::ofstream file(path, std::ios::binary);
+		ThrowIf<InvalidFilePath>(file.is_open() == false, "trace file path", path);
+		file.write(buffer.data(), buffer.length());
+	}
+
+	TraceFile Trace::Read(const std::filesystem::path& path)
+	{
+		const std::string contents = ReadFileToString(path, "trace file path");
+
+		// Checks the file is a trace this version can read //
+		TraceHeader header;
+		ThrowIf<InvalidFilePath>(contents.length() < sizeof(TraceHeader), "trace file path", path);
+		std::memcpy(&header, contents.data(), sizeof(TraceHeader));
+
+		const size_t eventBytes = header.eventCount * sizeof(TraceEvent);
+		ThrowIf<InvalidFilePath>(std::memcmp(header.magic, TRACE_MAGIC, sizeof(TRACE_MAGIC)) != 0 || header.version != TRACE_VERSION, "trace file path", path);
+		ThrowIf<InvalidFilePath>(contents.length() != sizeof(TraceHeader) + eventBytes + header.stringLength, "trace file path", path);
+
+		// Copies the events and the strings out of the file //
+		TraceFile trace;
+		trace.events.resize(header.eventCount);
+		std::memcpy(trace.events.data(), contents.data() + sizeof(TraceHeader), eventBytes);
+		trace.strings = contents.substr(sizeof(TraceHeader) + eventBytes);
+
+		return trace;
+	}
+}
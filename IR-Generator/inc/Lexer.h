@@ -7,8 +7,165 @@
 
 namespace LX
 {
-	// Struct to store the current information of the lexer //
-	struct LexerInfo;
+	// ID given to every unique identifier and keyword //
+	// Comparing and hashing the IDs is much faster than doing it to the names //
+	using SymbolID = uint32_t;
+
+	// The ID of tokens that do not have a name (such as symbols and literals) //
+	static constexpr SymbolID NO_SYMBOL = 0xFFFFFFFF;
+
+	// Gives every unique name within a compilation its own ID //
+	// Names are only hashed when they are added, everything after that uses the IDs //
+	class SymbolTable
+	{
+		public:
+			// Adds the keywords to the table so they have the same IDs in every table //
+			SymbolTable();
+
+			// Returns the ID of the name, adding it to the table if it is new //
+			SymbolID Intern(std::string_view name);
+
+			// Returns the ID of the name or NO_SYMBOL if it has not been added //
+			SymbolID Find(std::string_view name) const;
+
+			// Returns the name of the ID, the view is valid for as long as the table is //
+			inline std::string_view NameOf(SymbolID id) const { return m_Names[id]; }
+
+			// Returns the amount of unique names within the table //
+			inline size_t Size() const { return m_Names.size(); }
+
+		private:
+			// Copies the name into the memory of the table so it does not depend on the source staying alive //
+			std::string_view Store(std::string_view name);
+
+			// The names in the order of their IDs //
+			std::vector<std::string_view> m_Names;
+
+			// The ID of every name //
+			std::unordered_map<std::string_view, SymbolID> m_IDs;
+
+			// Blocks of memory the names are stored in //
+			// Names are packed together so there is not an allocation for each one //
+			std::vector<std::unique_ptr<char[]>> m_Blocks;
+
+			// The free space left in the current block //
+			char* m_BlockTop = nullptr;
+			size_t m_BlockSpace = 0;
+	};
+
+	// ID given to every file loaded by a SourceManager //
+	using FileID = uint32_t;
+
+	// A position within any of the files of a SourceManager, packed into 32-bits //
+	// Each file is given its own range of locations so the file and the offset within it can both be found from one //
+	struct SourceLocation
+	{
+		// Zero is never given to a file so it is used for locations that are not set //
+		uint32_t raw = 0;
+
+		// Returns if the location points to somewhere within a file //
+		inline bool IsValid() const { return raw != 0; }
+	};
+
+	// A location worked out into the information needed for printing it to the user //
+	struct ResolvedLocation
+	{
+		// The file the location is within //
+		FileID file;
+
+		// The line and column of the location, both starting on 1 //
+		// Columns count characters not bytes (tabs take up 4 columns) //
+		std::streamsize line;
+		std::streamsize column;
+
+		// The contents of the line the location is on (without the new line) //
+		std::string_view lineContents;
+	};
+
+	// Owns the contents of every file within a compilation and gives each one an ID //
+	// Lines and columns are only worked out when a location is resolved (such as for errors) //
+	class SourceManager
+	{
+		public:
+			// Maps the file into memory and gives it an ID //
+			FileID Load(const std::filesystem::path& path, const std::string& errorName = "input file path");
+
+			// Adds a source that is already in memory (such as a file after it has been edited) //
+			FileID Add(std::string contents, const std::filesystem::path& path);
+
+			// Getters for the information of the file with the given ID //
+
+			inline std::string_view SourceOf(FileID file) const { return m_Files[file]->source; }
+			inline const std::filesystem::path& PathOf(FileID file) const { return m_Files[file]->path; }
+			inline SourceLocation StartOf(FileID file) const { return { m_Files[file]->start }; }
+
+			// Returns the amount of files that have been loaded //
+			inline size_t Size() const { return m_Files.size(); }
+
+			// Returns the location of the index within the source of the file //
+			inline SourceLocation LocationOf(FileID file, std::streamsize index) const { return { m_Files[file]->start + (uint32_t)index }; }
+
+			// Returns the file the location is within //
+			FileID FileOf(SourceLocation location) const;
+
+			// Works out the file, line and column of the location //
+			ResolvedLocation Resolve(SourceLocation location) const;
+
+		private:
+			// Everything stored about each file //
+			struct FileEntry
+			{
+				// The path the file was loaded from //
+				std::filesystem::path path;
+
+				// The contents of the file are either mapped or owned by the entry //
+				std::unique_ptr<const SourceFile> mapped;
+				std::string owned;
+
+				// View of whichever of the above holds the contents //
+				std::string_view source;
+
+				// The first location given to the file //
+				uint32_t start = 0;
+
+				// The index of the first character of each line, created the first time a location in the file is resolved //
+				// Built once (even with multiple threads resolving locations) then binary searched for each location //
+				mutable std::vector<uint32_t> lineStarts;
+				mutable std::once_flag lineStartsCreated;
+			};
+
+			// Gives the file the next range of locations and adds it to the files //
+			FileID AddEntry(std::unique_ptr<FileEntry> entry);
+
+			// Returns the index of the first character of each line of the file, creating them if needed //
+			const std::vector<uint32_t>& LineStartsOf(const FileEntry& entry) const;
+
+			// The files in the order of their IDs //
+			// Stored on the heap so the views of their contents do not move when more are added //
+			std::vector<std::unique_ptr<FileEntry>> m_Files;
+
+			// The first location of the next file, starts on one as zero is left for invalid locations //
+			uint32_t m_NextStart = 1;
+	};
+
+	// The value of a number literal, worked out by the lexer so it is only converted once //
+	struct NumberValue
+	{
+		// Numbers with a decimal point are stored as doubles, every other number as a 32-bit int //
+		enum Kind : uint8_t
+		{
+			INTEGER,
+			DECIMAL
+		};
+
+		Kind kind;
+
+		union
+		{
+			int32_t integer;
+			double decimal;
+		};
+	};
 
 	// Data type to store a more computer readable version of files
 	struct __declspec(novtable) Token final
@@ -56,14 +213,18 @@ namespace LX
 		};
 	
 		// Constructor of the tokens to set their info //
-		Token(const TokenType _type, const LexerInfo& info, std::streamsize _length, const std::string& source);
+		Token(const TokenType _type, std::streamsize _index, std::streamsize _length, SourceLocation _location, std::string_view source, SymbolID _symbol = NO_SYMBOL);
 
-		// Works out the contents of the token and returns them as it is not stored in the token //
-		std::string GetContents() const;
+		// Returns a view of the token within the source, only valid whilst the source is alive //
+		std::string_view GetContents() const;
 
 		// Type of the token //
 		// Const to avoid external changes //
 		const TokenType type;
+
+		// The ID of the name of the token, only set for identifiers and keywords //
+		// Number literals store the index of their value within the TokenStream instead //
+		const SymbolID symbol;
 		
 		// Index in the source of the token //
 		const std::streamsize index;
@@ -71,19 +232,128 @@ namespace LX
 		// The length of the token on the line //
 		const std::streamsize length;
 
-		// The line the token is located on //
-		const std::streamsize line;
-
-		// The column on the line where it is located //
-		const std::streamsize column;
+		// Where the token is within the files of the SourceManager (used to find its line and column) //
+		const SourceLocation location;
 
 		// The contents of the token //
-		const std::string contents;
+		// Views into the source owned by FileTokens so no memory is allocated per token //
+		const std::string_view contents;
+	};
+
+	// The tokens of a source with each of their members stored in its own array //
+	// Lets the parser check the types of many tokens without loading the rest of their info //
+	class TokenStream
+	{
+		public:
+			// Constructor to set the source the tokens are within and the location of its first character //
+			TokenStream(std::string_view source = {}, SourceLocation start = {});
+
+			// Reserves space for roughly the amount of tokens within the given amount of the source //
+			void ReserveFor(std::streamsize sourceLength);
+
+			// Adds a token to the end of the stream //
+			// Sources are limited to 4GB so everything fits within 32-bits //
+			inline void Push(Token::TokenType type, std::streamsize index, std::streamsize length, SymbolID symbol = NO_SYMBOL)
+			{
+				m_Types.push_back((uint8_t)type);
+				m_Indices.push_back((uint32_t)index);
+				m_Lengths.push_back((uint32_t)length);
+				m_Symbols.push_back(symbol);
+			}
+
+			// Adds a number literal to the end of the stream alongside its value //
+			// Number literals do not have a name so their symbol is used to store the index of their value //
+			inline void PushNumber(std::streamsize index, std::streamsize length, NumberValue value)
+			{
+				Push(Token::NUMBER_LITERAL, index, length, (SymbolID)m_Numbers.size());
+				m_Numbers.push_back(value);
+			}
+
+			// Adds a copy of a token from another stream, moved along by the shift and given the symbol //
+			inline void PushCopy(const TokenStream& other, size_t i, std::streamsize shift, SymbolID symbol)
+			{
+				if (other.TypeAt(i) == Token::NUMBER_LITERAL) { PushNumber(other.IndexAt(i) + shift, other.LengthAt(i), other.NumberAt(i)); }
+				else { Push(other.TypeAt(i), other.IndexAt(i) + shift, other.LengthAt(i), symbol); }
+			}
+
+			// Returns the amount of tokens in the stream //
+			inline size_t Size() const { return m_Types.size(); }
+
+			// Getters for the members of the token at the given position in the stream //
+
+			inline Token::TokenType TypeAt(size_t i) const { return (Token::TokenType)m_Types[i]; }
+			inline std::streamsize IndexAt(size_t i) const { return m_Indices[i]; }
+			inline std::streamsize LengthAt(size_t i) const { return m_Lengths[i]; }
+			inline SymbolID SymbolAt(size_t i) const { return m_Symbols[i]; }
+
+			// Returns the value of the number literal at the given position //
+			inline const NumberValue& NumberAt(size_t i) const { return m_Numbers[m_Symbols[i]]; }
+
+			// Returns the location of the token, resolved by the SourceManager to get its line and column //
+			inline SourceLocation LocationAt(size_t i) const { return { m_Start.raw + m_Indices[i] }; }
+
+			// Returns a view of the token within the source, only valid whilst the source is alive //
+			inline std::string_view ContentsAt(size_t i) const { return m_Source.substr(m_Indices[i], m_Lengths[i]); }
+
+			// Creates the full token at the given position (used for errors and logging) //
+			Token At(size_t i) const;
+
+			// Returns the position of the first token starting at or after the index in the source //
+			size_t FindTokenAt(std::streamsize index, size_t from = 0) const;
+
+			// Returns the source the tokens are within //
+			inline std::string_view Source() const { return m_Source; }
+
+		private:
+			// The source the tokens are within //
+			std::string_view m_Source;
+
+			// The location of the first character of the source //
+			SourceLocation m_Start;
+
+			// The members of the tokens //
+			// The types are stored as a byte so a cache line holds the type of 64 tokens //
+
+			std::vector<uint8_t> m_Types;
+			std::vector<uint32_t> m_Indices;
+			std::vector<uint32_t> m_Lengths;
+			std::vector<SymbolID> m_Symbols;
+
+			// The values of the number literals in the order they are within the source //
+			std::vector<NumberValue> m_Numbers;
+	};
+
+	// The output of the lexer //
+	// The tokens view into the source of the file so the SourceManager it is within must outlive them //
+	struct FileTokens
+	{
+		// The file the tokens were created from //
+		FileID file;
+
+		// The tokens created from the source //
+		TokenStream tokens;
+
+		// The IDs of the names within the tokens //
+		SymbolTable symbols;
+	};
+
+	// An edit made to a source, the characters from start up to oldEnd were replaced with the ones from start up to newEnd //
+	struct SourceEdit
+	{
+		std::streamsize start;
+		std::streamsize oldEnd;
+		std::streamsize newEnd;
 	};
 
 	// Logging function to turn a tokentype enum val into it's string //
 	std::string ToString(Token::TokenType t);
 	
-	// Lexer function to take in a file and output a vector of tokens //
-	const std::vector<Token> LexicalAnalyze(const std::filesystem::path& path);
+	// Lexer function to take in a file loaded by the SourceManager and output its tokens //
+	// Large files are split over the given amount of threads, giving the same tokens as lexing on one //
+	FileTokens LexicalAnalyze(const SourceManager& sources, FileID file, unsigned threads = 1);
+
+	// Lexes a source again after it has been edited, only lexing the part the edit could have changed //
+	// The new source has to be added to the SourceManager, the returned tokens view into (and are located within) it //
+	// New names are added to the symbols so the IDs of the old tokens stay the same //
+	TokenStream RelexAfterEdit(const TokenStream& oldTokens, const SourceManager& sources, FileID newFile, const SourceEdit& edit, SymbolTable& symbols);
 }
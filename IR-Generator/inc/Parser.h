@@ -22,10 +22,6 @@ namespace LX::AST
 		// Used so a pointer to Node can be used and then turned into it's true type //
 		enum NodeType
 		{
-			// "Nodes" //
-
-			MULTI_NODE,
-
 			// General Nodes //
 
 			NUMBER_LITERAL,
@@ -49,20 +45,9 @@ namespace LX::AST
 		// Constructor to set the node type (no others provided) //
 		Node(NodeType type);
 
-		// Virtual destructor because of polymorphism //
-		virtual ~Node() = default;
-
-		// Function for generating LLVN IR (Intermediate representation) //
-		virtual llvm::Value* GenIR(InfoLLVM& LLVM, FunctionScope& func) = 0;
-
-		// Function to log the node to a file //
-		virtual void Log(unsigned depth) = 0;
-
-		// Function to get the node's type name //
-		virtual const char* TypeName() = 0;
-
-		// Function for generating C/C++ code (Currently not implemented) //
-		//virtual void GenC() = 0;
+		// There are no virtual functions (or destructor) //
+		// Passes over the AST switch on the type of the node instead (see Visitor.h) //
+		// Nodes are never destroyed, they are created within the arena of their FileAST which frees them all at once //
 
 		// The type of the node //
 		const NodeType m_Type;
@@ -71,6 +56,47 @@ namespace LX::AST
 
 namespace LX
 {
+	// Bump allocator that the nodes of an AST (and the arrays within them) are created in //
+	// Everything is freed at once when the arena is destroyed so destructors are never called //
+	class Arena
+	{
+		public:
+			// Returns memory of the given size and alignment that lives as long as the arena //
+			void* Allocate(size_t size, size_t alignment);
+
+			// Takes the memory of the other arena so it lives as long as this one, leaving the other empty //
+			// Used to join together the arenas of multiple threads //
+			void Adopt(Arena& other);
+
+			// Creates an object within the arena //
+			template<typename T, typename... Args>
+			T* Create(Args&&... args)
+			{
+				static_assert(std::is_trivially_destructible_v<T>, "Objects within an arena are never destroyed");
+				return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+			}
+
+			// Copies the items into an array within the arena //
+			template<typename T>
+			std::span<T> Copy(const T* items, size_t count)
+			{
+				static_assert(std::is_trivially_copyable_v<T>, "Arrays within an arena are copied as bytes and never destroyed");
+				RETURN_V_IF(std::span<T>{}, count == 0);
+
+				T* array = (T*)Allocate(sizeof(T) * count, alignof(T));
+				std::memcpy(array, items, sizeof(T) * count);
+				return std::span<T>(array, count);
+			}
+
+		private:
+			// Blocks of memory the objects are created in //
+			std::vector<std::unique_ptr<std::byte[]>> m_Blocks;
+
+			// The free space left in the current block //
+			std::byte* m_BlockTop = nullptr;
+			size_t m_BlockSpace = 0;
+	};
+
 	// Holds all needed info about a function //
 	// Currently only holds the body but in the future will hold: params, namespace/class-member //
 	struct FunctionDefinition
@@ -79,13 +105,13 @@ namespace LX
 		FunctionDefinition();
 
 		// The name of the function //
-		std::string name;
+		SymbolID name;
 
-		// The parameters of the function //
-		std::vector<std::string> params;
+		// The names of the parameters of the function //
+		std::vector<SymbolID> params;
 		
-		// The instructions of the body of the function //
-		std::vector<std::unique_ptr<AST::Node>> body;
+		// The instructions of the body of the function, created within the arena of the FileAST //
+		std::span<AST::Node*> body;
 	};
 
 	struct FileAST
@@ -95,11 +121,23 @@ namespace LX
 
 		// All the functions within this file //
 		std::vector<FunctionDefinition> functions;
+
+		// Owns the memory of all the nodes within the functions //
+		Arena arena;
 	};
 
 	// Turns the tokens of a file into it's abstract syntax tree equivalent //
-	FileAST TurnTokensIntoAbstractSyntaxTree(std::vector<Token>& tokens, const std::filesystem::path& path);
+	// The tokens (and the SourceManager they view into) must outlive the call //
+	// Files with lots of functions are parsed over the given amount of threads, the AST is identical to parsing on one //
+	FileAST TurnTokensIntoAbstractSyntaxTree(const FileTokens& tokens, const SourceManager& sources, unsigned threads = 1);
 
 	// Turns an abstract binary tree into LLVM intermediate representation //
-	void GenerateIR(FileAST& ast, const std::string& name, const std::filesystem::path& IRPath);
+	// The symbols are the ones the AST was created with, used to give the IR its names //
+	// Files with lots of functions are generated over the given amount of threads, the IR is identical to generating it on one //
+	void GenerateIR(FileAST& ast, const SymbolTable& symbols, const std::string& name, const std::filesystem::path& IRPath, unsigned threads = 1);
+
+	// Compiles a file of LLVM IR into object files for the machine it is running on //
+	// Modules with lots of functions are split into parts that are each compiled on their own thread to their own object file //
+	// Returns the paths of the object files, which are the given path with the index of the part added to the end of the name //
+	std::vector<std::filesystem::path> CompileIR(const std::filesystem::path& IRPath, const std::filesystem::path& objPath, unsigned threads = 1);
 }
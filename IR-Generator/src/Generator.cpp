@@ -3,42 +3,24 @@
 #include <Parser.h>
 #include <Lexer.h>
 
-extern "C" int __declspec(dllexport) GenIR(const char* a_inpPath, const char* a_outPath)
+// Calls the function, turning any errors it throws into console output and an exit code of -1 //
+template<typename Func>
+static int CatchErrors(Func func)
 {
 	try
 	{
-		// Initalises the log //
-		LX::Log::Init(LX::Log::Priority::HIGH);
-
-		// Turns the file paths into the C++ type for handling them //
-		std::filesystem::path inpPath = a_inpPath;
-		std::filesystem::path outPath = a_outPath;
-
-		// Opens / Creates the output file //
-		std::ofstream outFile(outPath);
-		LX::ThrowIf<LX::InvalidFilePath>(outFile.is_open() == false, "output file path", outPath);
-		outFile.close(); // Opened just to check we can
-
-		// Prints the full paths to the console to let the user know compiling is being done //
-		std::cout << std::filesystem::absolute(inpPath) << " -> " << std::filesystem::absolute(outPath) << std::endl;
-
-		// Create tokens out of the input file //
-		std::vector<LX::Token>tokens = LX::LexicalAnalyze(inpPath);
-
-		// Turns the tokens into an AST //
-		LX::FileAST AST = LX::TurnTokensIntoAbstractSyntaxTree(tokens, inpPath);
-
-		// Turns the AST into LLVM IR //
-		LX::GenerateIR(AST, inpPath.filename().string(), outPath);
-
-		// Returns success
-		return 0;
+		// Closes the log so everything is written before returning //
+		// It is not left to the exit of the program as the background thread cannot be waited for then //
+		const int result = func();
+		LX::Log::Close();
+		return result;
 	}
 
 	catch(LX::RuntimeError& e)
 	{
-		// Logs the error. Does not need to close it as it is done after this function returns //
-		LX::Log::LogNewSection("Error thrown of type: ", e.ErrorType());
+		// Logs the error and closes the log //
+		LX_LOG_SECTION("Error thrown of type: ", e.ErrorType());
+		LX::Log::Close();
 
 		// Logs the errors type to the console if built as Debug //
 		#ifdef _DEBUG
@@ -61,8 +43,9 @@ extern "C" int __declspec(dllexport) GenIR(const char* a_inpPath, const char* a_
 			__debugbreak();
 		}
 
-		// Logs the error. Does not need to close it as it is done after this function returns //
-		LX::Log::LogNewSection("std::exception thrown: ", e.what());
+		// Logs the error and closes the log //
+		LX_LOG_SECTION("std::exception thrown: ", e.what());
+		LX::Log::Close();
 
 		// Prints the std exception to the console //
 		// Any errors here are problems with the code //
@@ -82,7 +65,103 @@ extern "C" int __declspec(dllexport) GenIR(const char* a_inpPath, const char* a_
 			__debugbreak();
 		}
 
+		LX::Log::Close();
+
 		// Exit code -1 means an undefined error //
 		return -1;
 	}
 }
+
+// Flags that can be passed to GenIR //
+// Writes how long each phase took to a JSON file next to the output (with the extension .time.json) //
+static constexpr int GEN_IR_TIME_REPORT = 1 << 0;
+
+// Writes a timeline of each phase on each thread next to the output (with the extension .trace.json) //
+// It can be viewed by opening it in chrome://tracing or Perfetto //
+static constexpr int GEN_IR_TIMELINE = 1 << 1;
+
+extern "C" int __declspec(dllexport) GenIR(const char* a_inpPath, const char* a_outPath, int a_flags)
+{
+	// Owns the contents of the files being compiled //
+	// Created outside of the try so the errors can still find where they happened after it has exited //
+	LX::SourceManager sources;
+
+	return CatchErrors([&]()
+	{
+		// Initalises the log and the profiler //
+		LX::Log::Init(LX::Log::Priority::HIGH);
+		LX::Profiler::Begin((a_flags & GEN_IR_TIME_REPORT) != 0, (a_flags & GEN_IR_TIMELINE) != 0);
+		LX::MemoryTracker::Reset();
+
+		LX::Timer timer;
+
+		// Turns the file paths into the C++ type for handling them //
+		std::filesystem::path inpPath = a_inpPath;
+		std::filesystem::path outPath = a_outPath;
+
+		// Opens / Creates the output file //
+		std::ofstream outFile(outPath);
+		LX::ThrowIf<LX::InvalidFilePath>(outFile.is_open() == false, "output file path", outPath);
+		outFile.close(); // Opened just to check we can
+
+		// Prints the full paths to the console to let the user know compiling is being done //
+		std::cout << std::filesystem::absolute(inpPath) << " -> " << std::filesystem::absolute(outPath) << std::endl;
+
+		// Create tokens out of the input file //
+		// The tokens view into the source held by the SourceManager //
+		LX::MemoryTracker::BeginPhase("read");
+		const LX::FileID inpFile = sources.Load(inpPath);
+		LX::Profiler::AddPhase("read", timer.Restart());
+		LX::Profiler::AddCount("source_bytes", sources.SourceOf(inpFile).length());
+
+		LX::MemoryTracker::BeginPhase("lex");
+		LX::FileTokens tokens = LX::LexicalAnalyze(sources, inpFile, std::thread::hardware_concurrency());
+		LX::Profiler::AddPhase("lex", timer.Restart());
+		LX::Profiler::AddCount("tokens", tokens.tokens.Size());
+
+		// Checks the tokens are within the memory bound (when built with LX_TRACK_MEMORY) //
+		LX::MemoryTracker::CheckTokenMemory(sources.SourceOf(inpFile).length());
+
+		// Turns the tokens into an AST //
+		LX::MemoryTracker::BeginPhase("parse");
+		LX::FileAST AST = LX::TurnTokensIntoAbstractSyntaxTree(tokens, sources, std::thread::hardware_concurrency());
+		LX::Profiler::AddPhase("parse", timer.Restart());
+		LX::Profiler::AddCount("functions", AST.functions.size());
+
+		// Turns the AST into LLVM IR (timed within as it has multiple phases) //
+		LX::GenerateIR(AST, tokens.symbols, inpPath.filename().string(), outPath, std::thread::hardware_concurrency());
+
+		// Writes the report of how long everything took //
+		if (LX::Profiler::IsEnabled())
+		{
+			LX::Profiler::WriteReport(std::filesystem::path(outPath).replace_extension(".time.json"));
+		}
+
+		if (LX::Profiler::IsTracing())
+		{
+			LX::Profiler::WriteTimeline(std::filesystem::path(outPath).replace_extension(".trace.json"));
+		}
+
+		// Returns success
+		return 0;
+	});
+}
+
+// Compiles the IR file to object files on the given amount of threads (0 uses every core) //
+// Returns how many object files were created, object file N is at the output path with "-N" added to the end of the name //
+extern "C" int __declspec(dllexport) CompileIR(const char* a_inpPath, const char* a_outPath, int a_threads)
+{
+	return CatchErrors([&]()
+	{
+		const unsigned threads = (a_threads > 0) ? (unsigned)a_threads : std::thread::hardware_concurrency();
+		std::vector<std::filesystem::path> objects = LX::CompileIR(a_inpPath, a_outPath, threads);
+
+		// Prints the object files to the console to let the user know they have been created //
+		for (const std::filesystem::path& object : objects)
+		{
+			std::cout << a_inpPath << " -> " << object.string() << std::endl;
+		}
+
+		return (int)objects.size();
+	});
+}
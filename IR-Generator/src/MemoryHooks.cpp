@@ -0,0 +1,72 @@
+#include <LX-Common.h>
+
+// Replaces operator new and delete to count every allocation (when built with LX_TRACK_MEMORY) //
+// Only allocations made within this DLL are counted, which includes the lexer, parser and LLVM as they are linked into it //
+#if LX_TRACK_MEMORY
+
+// Every allocation has a header before it storing its size and the phase it was made in //
+static constexpr size_t HEADER_SIZE = sizeof(LX::MemoryTracker::Header);
+
+static void* TrackedAllocate(size_t size, size_t alignment)
+{
+	alignment = std::max(alignment, HEADER_SIZE);
+
+	// Allocates enough room to align the allocation after the header //
+	// malloc is aligned to at least the size of the header so the allocation is never more than the alignment past the start //
+	std::byte* raw = (std::byte*)std::malloc(size + alignment);
+	if (raw == nullptr) { return nullptr; }
+
+	std::byte* allocation = (std::byte*)(((uintptr_t)raw + HEADER_SIZE + alignment - 1) & ~(uintptr_t)(alignment - 1));
+
+	LX::MemoryTracker::Header* header = new (allocation - HEADER_SIZE) LX::MemoryTracker::Header;
+	header->size = size;
+	header->offset = (uint32_t)(allocation - raw);
+	LX::MemoryTracker::Allocated(*header);
+
+	return allocation;
+}
+
+static void TrackedFree(void* allocation)
+{
+	if (allocation == nullptr) { return; }
+
+	const LX::MemoryTracker::Header* header = (const LX::MemoryTracker::Header*)((std::byte*)allocation - HEADER_SIZE);
+	LX::MemoryTracker::Freed(*header);
+
+	std::free((std::byte*)allocation - header->offset);
+}
+
+// Throws if the allocation failed, as the standard versions do //
+static void* TrackedNew(size_t size, size_t alignment)
+{
+	void* allocation = TrackedAllocate(size, alignment);
+	if (allocation == nullptr) { throw std::bad_alloc(); }
+
+	return allocation;
+}
+
+void* operator new(size_t size) { return TrackedNew(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new[](size_t size) { return TrackedNew(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new(size_t size, std::align_val_t alignment) { return TrackedNew(size, (size_t)alignment); }
+void* operator new[](size_t size, std::align_val_t alignment) { return TrackedNew(size, (size_t)alignment); }
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return TrackedAllocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return TrackedAllocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return TrackedAllocate(size, (size_t)alignment); }
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return TrackedAllocate(size, (size_t)alignment); }
+
+void operator delete(void* allocation) noexcept { TrackedFree(allocation); }
+void operator delete[](void* allocation) noexcept { TrackedFree(allocation); }
+void operator delete(void* allocation, size_t) noexcept { TrackedFree(allocation); }
+void operator delete[](void* allocation, size_t) noexcept { TrackedFree(allocation); }
+void operator delete(void* allocation, std::align_val_t) noexcept { TrackedFree(allocation); }
+void operator delete[](void* allocation, std::align_val_t) noexcept { TrackedFree(allocation); }
+void operator delete(void* allocation, size_t, std::align_val_t) noexcept { TrackedFree(allocation); }
+void operator delete[](void* allocation, size_t, std::align_val_t) noexcept { TrackedFree(allocation); }
+
+void operator delete(void* allocation, const std::nothrow_t&) noexcept { TrackedFree(allocation); }
+void operator delete[](void* allocation, const std::nothrow_t&) noexcept { TrackedFree(allocation); }
+void operator delete(void* allocation, std::align_val_t, const std::nothrow_t&) noexcept { TrackedFree(allocation); }
+void operator delete[](void* allocation, std::align_val_t, const std::nothrow_t&) noexcept { TrackedFree(allocation); }
+
+#endif // LX_TRACK_MEMORY
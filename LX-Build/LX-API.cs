@@ -10,11 +10,21 @@ namespace LX_Build
         [return: MarshalAs(UnmanagedType.Bool)]
         private static partial bool SetDllDirectory(string lpPathName);
 
+        // Flags that can be passed to GenIR, must match the ones within Generator.cpp //
+        public const int GEN_IR_TIME_REPORT = 1 << 0;
+        public const int GEN_IR_TIMELINE = 1 << 1;
+
         // Imports the Frontend of the compiler //
         [LibraryImport ("Generator.dll", StringMarshalling = StringMarshalling.Custom,
             StringMarshallingCustomType = typeof(System.Runtime.InteropServices.Marshalling.AnsiStringMarshaller))]
         [UnmanagedCallConv(CallConvs = new Type[] { typeof(System.Runtime.CompilerServices.CallConvCdecl) })]
-        public static partial int GenIR(string arg1, string arg2);
+        public static partial int GenIR(string arg1, string arg2, int flags);
+
+        // Imports the Backend of the compiler, returns the amount of object files created //
+        [LibraryImport ("Generator.dll", StringMarshalling = StringMarshalling.Custom,
+            StringMarshallingCustomType = typeof(System.Runtime.InteropServices.Marshalling.AnsiStringMarshaller))]
+        [UnmanagedCallConv(CallConvs = new Type[] { typeof(System.Runtime.CompilerServices.CallConvCdecl) })]
+        public static partial int CompileIR(string arg1, string arg2, int threads);
 
         // Sets the directory to import the DLLs from //
         public static void Init()
@@ -5,47 +5,86 @@ namespace LX_Build
 {
     class Program
     {
-        static void CompileToObj(string inPath, string outPath)
+        static List<string> CompileToObj(string inPath, string outPath, int threads)
         {
-            // The arguments to compiler LLVM IR to object files //
-            string arguments = $"-filetype=obj -o \"{outPath}\" \"{inPath}\"";
+            // Compiles the LLVM IR to object files within the C++ code //
+            int count = LX_API.CompileIR(inPath, outPath, threads);
 
-            // Runs the command //
-            CommandProcess process = new("llc", arguments);
+            if (count < 0)
+            {
+                // The C++ script handles all of the error message outputting //
+                Console.WriteLine("LX_API.CompileIR threw an error");
+                return new();
+            }
 
-            if (process.ExitCode() == 0)
+            // Object file N has "-N" added to the end of the name of the output path //
+            List<string> objectFiles = new();
+            for (int i = 0; i < count; i++)
             {
-                Console.WriteLine(inPath + " -> " + outPath);
-                return;
+                objectFiles.Add(Path.Combine(Path.GetDirectoryName(outPath) ?? "", $"{Path.GetFileNameWithoutExtension(outPath)}-{i}{Path.GetExtension(outPath)}"));
             }
 
-            Console.WriteLine(process.Error());
+            return objectFiles;
         }
 
-        static void LinkToExe(string objectFile)
+        static void LinkToExe(List<string> objectFiles)
         {
             // The arguments to turn object files into an .exe //
-            string arguments = $"/OUT:example/Main.exe {objectFile} /ENTRY:main";
+            string objects = string.Join(" ", objectFiles.Select(file => $"\"{file}\""));
+            string arguments = $"/OUT:example/Main.exe {objects} /ENTRY:main";
 
             // Runs the command //
             CommandProcess process = new("lld-link", arguments);
 
             if (process.ExitCode() == 0)
             {
-                Console.WriteLine(objectFile + " -> " + "Main.exe");
+                Console.WriteLine(string.Join(", ", objectFiles) + " -> " + "Main.exe");
                 return;
             }
 
             Console.WriteLine(process.Error());
         }
 
-        static void Main()
+        // Returns the amount of threads to compile with, set with "-j N" (0 uses every core) //
+        static int ThreadCount(string[] args)
+        {
+            int index = Array.IndexOf(args, "-j");
+
+            if (index >= 0 && index + 1 < args.Length && int.TryParse(args[index + 1], out int threads))
+            {
+                return threads;
+            }
+
+            return 0;
+        }
+
+        // Returns the flags to generate the IR with //
+        // "--time-report" writes how long each phase took to example/main.time.json //
+        // "--timeline" writes when each phase ran on each thread to example/main.trace.json //
+        static int GenIRFlags(string[] args)
+        {
+            int flags = 0;
+
+            if (Array.IndexOf(args, "--time-report") >= 0)
+            {
+                flags |= LX_API.GEN_IR_TIME_REPORT;
+            }
+
+            if (Array.IndexOf(args, "--timeline") >= 0)
+            {
+                flags |= LX_API.GEN_IR_TIMELINE;
+            }
+
+            return flags;
+        }
+
+        static void Main(string[] args)
         {
             // Initalises the CPP interface, MUST ALWAYS BE CALLED FIRST //
             LX_API.Init();
 
             // Generates LLVM IR with the example files //
-            if (LX_API.GenIR("example/main.lx", "example/main.ll") != 0)
+            if (LX_API.GenIR("example/main.lx", "example/main.ll", GenIRFlags(args)) != 0)
             {
                 // Quits if the IR Generation fails //
                 // The C++ script handles all of the error message outputting //
@@ -53,11 +92,16 @@ namespace LX_Build
                 return;
             }
 
-            // Compilers the LLVM IR to an object file using the command line //
-            CompileToObj("example/main.ll", "example/main.obj");
+            // Compiles the LLVM IR to object files //
+            List<string> objectFiles = CompileToObj("example/main.ll", "example/main.obj", ThreadCount(args));
+
+            if (objectFiles.Count == 0)
+            {
+                return;
+            }
 
-            // Links the object file to an .exe //
-            LinkToExe("example/main.obj");
+            // Links the object files to an .exe //
+            LinkToExe(objectFiles);
 
             // Runs the outputted .exe //
             string command = "example/Main.exe";
@@ -0,0 +1,2 @@
+// Wow, such an intresting file. Don't put anything else in here //
+#include <LX-Common.h>
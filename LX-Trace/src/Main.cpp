@@ -0,0 +1,138 @@
+#include <LX-Common.h>
+
+#include <Parser.h>
+#include <Lexer.h>
+
+#include <AST.h>
+
+// Writes the event as the text the log would have written if it was not a trace //
+static void WriteEvent(std::ostream& out, const LX::TraceFile& trace, const LX::TraceEvent& event, std::string_view& source)
+{
+	using namespace LX;
+
+	switch (event.type)
+	{
+		case TraceEventType::TEXT:
+			out << trace.StringOf(event);
+			return;
+
+		case TraceEventType::SOURCE:
+			source = trace.StringOf(event);
+			return;
+
+		case TraceEventType::TOKEN:
+		{
+			const std::streamsize index = (std::streamsize)(event.b >> 32);
+			const std::streamsize length = (std::streamsize)(uint32_t)event.b;
+
+			// Clamped to the source in case the trace was cut short or the tokens do not match it //
+			const std::string_view contents = source.substr(std::min((size_t)index, source.size()), (size_t)length);
+
+			out << std::left
+				<< "T-Index: " << std::setw(5) << event.a
+				<< " { Index: " << std::setw(3) << index
+				<< ", Length: " << std::setw(2) << length << " } "
+				<< std::setw(30) << ToString((Token::TokenType)(int8_t)event.kind) + ":" << "{" << contents << "}\n";
+
+			return;
+		}
+
+		case TraceEventType::NUMBER_INTEGER:
+			out << Log::Indent(event.depth) << "Number: " << (int32_t)event.b << '\n';
+			return;
+
+		case TraceEventType::NUMBER_DECIMAL:
+			out << Log::Indent(event.depth) << "Number: " << std::bit_cast<double>(event.b) << '\n';
+			return;
+
+		case TraceEventType::OPERATION:
+			out << Log::Indent(event.depth) << "Operation {" << ToString((Token::TokenType)(int8_t)event.kind) << "}:\n";
+			out << Log::Indent(event.depth + 1) << "LHS:\n";
+			return;
+
+		case TraceEventType::OPERATION_RHS:
+			out << Log::Indent(event.depth + 1) << "RHS:\n";
+			return;
+
+		case TraceEventType::RETURN_STATEMENT:
+			out << Log::Indent(event.depth) << "Return";
+			return;
+
+		case TraceEventType::VARIABLE_DECLARATION:
+			out << Log::Indent(event.depth) << "Variable declaration: " << trace.StringOf(event) << '\n';
+			return;
+
+		case TraceEventType::VARIABLE_ASSIGNMENT:
+			out << Log::Indent(event.depth) << "Variable assignment:\n";
+			out << Log::Indent(event.depth + 1) << "To: " << trace.StringOf(event) << '\n';
+			out << Log::Indent(event.depth + 1) << "Value:\n";
+			return;
+
+		case TraceEventType::VARIABLE_ACCESS:
+			out << Log::Indent(event.depth) << "Variable: " << trace.StringOf(event) << '\n';
+			return;
+
+		case TraceEventType::FUNCTION_CALL:
+			out << Log::Indent(event.depth) << "Function call{" << trace.StringOf(event) << "}:\n";
+			if (event.kind != 0) { out << Log::Indent(event.depth + 1) << "Args:\n"; }
+			return;
+
+		case TraceEventType::GENERATING_NODE:
+			out << "Generating: " << AST::TypeName((AST::Node::NodeType)(int8_t)event.kind) << '\n';
+			return;
+
+		default:
+			out << "Unknown trace event\n";
+			return;
+	}
+}
+
+// Turns a binary trace (log.trace) back into the text log //
+// Usage: lx-trace <trace file> [output file], the text is written to the console if there is no output file //
+int main(int argc, char** argv)
+{
+	if (argc < 2)
+	{
+		std::cout << "Usage: lx-trace <trace file> [output file]" << std::endl;
+		return -1;
+	}
+
+	try
+	{
+		const LX::TraceFile trace = LX::Trace::Read(argv[1]);
+
+		// Opens the output file (if there is one) //
+		std::ofstream file;
+		if (argc > 2)
+		{
+			file.open(argv[2]);
+			LX::ThrowIf<LX::InvalidFilePath>(file.is_open() == false, "output file path", argv[2]);
+		}
+
+		std::ostream& out = (argc > 2) ? file : std::cout;
+
+		// The source the tokens are within, each file being lexed is added before its tokens //
+		std::string_view source;
+
+		for (const LX::TraceEvent& event : trace.events)
+		{
+			WriteEvent(out, trace, event, source);
+		}
+
+		return 0;
+	}
+
+	catch (LX::RuntimeError& e)
+	{
+		e.PrintToConsole();
+		return -1;
+	}
+
+	// Catches any std errors, such as the strings of a damaged trace being out of range //
+	catch (std::exception& e)
+	{
+		std::cout << "An error occured whilst reading the trace.\n" << std::endl;
+		std::cout << e.what() << std::endl;
+		return -1;
+	}
+}
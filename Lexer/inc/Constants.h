@@ -2,10 +2,20 @@
 
 #include <Lexer.h>
 
+#include <bit>
+
 namespace LX
 {
+	// A word that is turned into its own type of token instead of an IDENTIFIER //
+	struct Keyword
+	{
+		std::string_view word;
+		Token::TokenType type;
+	};
+
 	// All the keywords the lexer currently supports with their token-enum equivalents //
-	static const std::unordered_map<std::string, Token::TokenType> keywords =
+	// The lookup table below is generated from this list so new keywords only need to be added here //
+	static constexpr Keyword keywords[] =
 	{
 		{ "for"			, Token::FOR		},
 		{ "while"		, Token::WHILE		},
@@ -17,8 +27,88 @@ namespace LX
 		{ "int"			, Token::INT_DEC	}
 	};
 
+	// Size of the keyword hash table, kept at least twice the amount of keywords to make finding a seed easy //
+	static constexpr uint32_t keywordTableBits = std::bit_width(std::size(keywords) * 2 - 1);
+	static constexpr uint32_t keywordTableSize = 1u << keywordTableBits;
+
+	// Hashes a word by its first character, last character and length //
+	// Words passed in are never empty as they are only created from letters //
+	static constexpr uint32_t HashKeyword(std::string_view word, uint32_t seed)
+	{
+		const uint32_t key = (uint32_t)(unsigned char)word.front() | ((uint32_t)(unsigned char)word.back() << 8) | ((uint32_t)word.length() << 16);
+		return (key * seed) >> (32 - keywordTableBits);
+	}
+
+	// Finds a seed which gives every keyword its own slot in the table //
+	static consteval uint32_t FindKeywordSeed()
+	{
+		// Tries odd multiples of a well mixing multiplier so each seed spreads the words differently //
+		for (uint32_t attempt = 0; attempt < 0x1000; attempt++)
+		{
+			const uint32_t seed = 0x9E3779B1 * ((attempt * 2) + 1);
+			std::array<bool, keywordTableSize> used = {};
+			bool collided = false;
+
+			for (const Keyword& keyword : keywords)
+			{
+				const uint32_t slot = HashKeyword(keyword.word, seed);
+				collided = collided || used[slot];
+				used[slot] = true;
+			}
+
+			if (collided == false) { return seed; }
+		}
+
+		// Never reached with the current keywords, stops the table from compiling if it ever is //
+		throw "Could not find a perfect hash for the keywords";
+	}
+
+	static constexpr uint32_t keywordSeed = FindKeywordSeed();
+
+	// A slot of the keyword hash table //
+	struct KeywordSlot
+	{
+		std::string_view word;
+		Token::TokenType type;
+
+		// Keywords are the first names added to every symbol table so their ID is their position in the list //
+		SymbolID symbol;
+	};
+
+	// Generates the table of which keyword (if any) is in each slot //
+	static consteval std::array<KeywordSlot, keywordTableSize> GenerateKeywordTable()
+	{
+		// Empty slots can never match as words are never empty //
+		std::array<KeywordSlot, keywordTableSize> table = {};
+		table.fill({ "", Token::UNDEFINED, NO_SYMBOL });
+
+		for (SymbolID i = 0; i < std::size(keywords); i++)
+		{
+			table[HashKeyword(keywords[i].word, keywordSeed)] = { keywords[i].word, keywords[i].type, i };
+		}
+
+		return table;
+	}
+
+	static constexpr std::array<KeywordSlot, keywordTableSize> keywordTable = GenerateKeywordTable();
+
+	// Returns the slot of the keyword or nullptr if the word is not a keyword //
+	// As the hash is perfect only a single string comparison is needed //
+	static constexpr const KeywordSlot* FindKeyword(std::string_view word)
+	{
+		const KeywordSlot& slot = keywordTable[HashKeyword(word, keywordSeed)];
+		return slot.word == word ? &slot : nullptr;
+	}
+
+	// A character that is turned into a token on its own //
+	struct SingleCharToken
+	{
+		char c;
+		Token::TokenType type;
+	};
+
 	// All the symbols supported by the lexer //
-	static const std::unordered_map<char, Token::TokenType> symbols =
+	static constexpr SingleCharToken symbols[] =
 	{
 		{ '{', Token::OPEN_BRACKET		},
 		{ '}', Token::CLOSE_BRACKET		},
@@ -32,11 +122,77 @@ namespace LX
 
 	// All the single-char operators currently supported by the lexer with their token-enum equivalents //
 	// TODO: Support multi-char operators such as: ==, -> +=, &&
-	static const std::unordered_map<char, Token::TokenType> operators =
+	static constexpr SingleCharToken operators[] =
 	{
 		{ '+', Token::ADD },
 		{ '-', Token::SUB },
 		{ '*', Token::MUL },
 		{ '/', Token::DIV }
 	};
+
+	// The different classes a byte of the source can belong to //
+	// Each one decides which state the lexer goes into when it is found //
+	enum class CharClass : unsigned char
+	{
+		INVALID,
+
+		ALPHA,
+		NUMERIC,
+
+		UNICODE, // <- Start of a character that is not ASCII, only valid if it is a letter
+
+		QUOTE,
+		HASH,
+
+		SPACE,
+		TAB,
+		NEW_LINE,
+
+		SINGLE_CHAR_TOKEN
+	};
+
+	// Generates the class of every byte at compile time //
+	static consteval std::array<CharClass, 256> GenerateCharClasses()
+	{
+		// Everything not listed below is invalid //
+		std::array<CharClass, 256> classes = {};
+		classes.fill(CharClass::INVALID);
+
+		for (unsigned c = 'a'; c <= 'z'; c++) { classes[c] = CharClass::ALPHA; }
+		for (unsigned c = 'A'; c <= 'Z'; c++) { classes[c] = CharClass::ALPHA; }
+		for (unsigned c = '0'; c <= '9'; c++) { classes[c] = CharClass::NUMERIC; }
+		classes['.'] = CharClass::NUMERIC; // <- Decimal points are part of numbers
+
+		for (unsigned c = 0x80; c <= 0xFF; c++) { classes[c] = CharClass::UNICODE; }
+
+		classes['"'] = CharClass::QUOTE;
+		classes['#'] = CharClass::HASH;
+
+		classes[' '] = CharClass::SPACE;
+		classes['\r'] = CharClass::SPACE;
+		classes['\t'] = CharClass::TAB;
+		classes['\n'] = CharClass::NEW_LINE;
+
+		for (const SingleCharToken& sym : symbols) { classes[(unsigned char)sym.c] = CharClass::SINGLE_CHAR_TOKEN; }
+		for (const SingleCharToken& op : operators) { classes[(unsigned char)op.c] = CharClass::SINGLE_CHAR_TOKEN; }
+
+		return classes;
+	}
+
+	// Generates the token type of every byte that is a token on its own //
+	static consteval std::array<Token::TokenType, 256> GenerateSingleCharTokens()
+	{
+		std::array<Token::TokenType, 256> types = {};
+		types.fill(Token::UNDEFINED);
+
+		for (const SingleCharToken& sym : symbols) { types[(unsigned char)sym.c] = sym.type; }
+		for (const SingleCharToken& op : operators) { types[(unsigned char)op.c] = op.type; }
+
+		return types;
+	}
+
+	// Lookup tables indexed by the byte of the source //
+
+	static constexpr std::array<CharClass, 256> charClasses = GenerateCharClasses();
+	static constexpr std::array<Token::TokenType, 256> singleCharTokens = GenerateSingleCharTokens();
 }
@@ -11,14 +11,58 @@ namespace LX
 	{
 		GENERATE_LX_ERROR_REQUIRED_FUNCTION_DECLARATIONS;
 
-		InvalidCharInSource(const LexerInfo& info, const std::string _file);
+		InvalidCharInSource(const LexerInfo& info);
 
-		std::string lineContents;
-		std::string file;
+		// The files being compiled, used to find the file, line and column of the error //
+		const SourceManager& sources;
+		SourceLocation location;
+
+		// The character that was invalid, can be multiple bytes if it is not ASCII //
+		std::string invalid;
+	};
+
+	// Error thrown when the source is not valid UTF-8 //
+	struct InvalidUTF8InSource : public RuntimeError
+	{
+		GENERATE_LX_ERROR_REQUIRED_FUNCTION_DECLARATIONS;
 
-		std::streamsize col;
-		std::streamsize line;
+		InvalidUTF8InSource(const SourceManager& _sources, SourceLocation _location, unsigned char _byte);
+
+		// The files being compiled, used to find the file, line and column of the error //
+		const SourceManager& sources;
+		SourceLocation location;
+
+		// The first byte that is not part of a valid character //
+		unsigned char byte;
+	};
+
+	// Error thrown when a number literal is not a valid number or does not fit within its type //
+	struct InvalidNumberLiteral : public RuntimeError
+	{
+		GENERATE_LX_ERROR_REQUIRED_FUNCTION_DECLARATIONS;
 
-		char invalid;
+		InvalidNumberLiteral(const LexerInfo& info, std::streamsize start, bool _outOfRange);
+
+		// The files being compiled, used to find the file, line and column of the error //
+		const SourceManager& sources;
+		SourceLocation location;
+
+		std::string literal;
+
+		// If the literal was a valid number but too large for its type //
+		bool outOfRange;
+	};
+
+	// Error thrown when an edit given to the lexer does not fit the sources it was given with //
+	CREATE_EMPTY_LX_ERROR_TYPE(InvalidSourceEdit);
+
+	// Error thrown when the sources are too large for their locations to fit within 32-bits //
+	struct SourceTooLarge : public RuntimeError
+	{
+		GENERATE_LX_ERROR_REQUIRED_FUNCTION_DECLARATIONS;
+
+		SourceTooLarge(const std::string _file);
+
+		std::string file;
 	};
 }
@@ -2,46 +2,52 @@
 
 #include <LX-Common.h>
 
+#include <Lexer.h>
+
+#include <ScanKernels.h>
+
 namespace LX
 {
 	// Struct to store the current information of the lexer //
 	struct LexerInfo
 	{
 		// Constructor to set the constants //
-		LexerInfo(const std::string& _source)
-			: source(_source), len(_source.length())
+		LexerInfo(const SourceManager& _sources, FileID file, SymbolTable& _symbols)
+			: source(_sources.SourceOf(file)), len(source.length()), sources(_sources), start(_sources.StartOf(file)), kernels(GetScanKernels()), symbols(_symbols)
 		{}
 
-		// Current trackers of where in the source it is //
+		// Constructor for lexing part of the source, from begin up to end //
+		LexerInfo(const SourceManager& _sources, FileID file, SymbolTable& _symbols, std::streamsize begin, std::streamsize end)
+			: index(begin), source(_sources.SourceOf(file)), len(end), sources(_sources), start(_sources.StartOf(file)), kernels(GetScanKernels()), symbols(_symbols)
+		{}
 
-		std::streamsize line = 1; // <- Lines start on 1 (probably because of non-programmer's)
+		// Current tracker of where in the source it is //
+		// Lines and columns are not tracked as the SourceManager works them out when they are needed //
 		std::streamsize index = 0;
-		std::streamsize column = 0; // <- Columns start on 1 (probably because of non-programmer's). THEN WHY IS THIS SET TO 0
-
-		// Trackers for when a multi-char token started //
 
-		std::streamsize startOfWord = 0;
-		std::streamsize startOfNumberLiteral = 0;
+		// Tracker for when a string literal started (the index of the opening quote) //
 		std::streamsize startOfStringLiteral = 0;
 
 		// Information about the source //
+		// The length is where the lexer stops, which is before the end of the source when only lexing part of it //
 
-		const std::string& source;
+		const std::string_view source;
 		const std::streamsize len;
 
-		// Different flags of the lexer //
-		// Stored as a bitset to minimse memory allocated //
-		// - Basically no difference, because only one exists at any given time //
-		// - But it is a cool C++ feature I like so I use it //
+		// The files being compiled and the location of the first character of the source (used for errors) //
+		const SourceManager& sources;
+		const SourceLocation start;
+
+		// The functions used to skip over runs of bytes (picked depending on the CPU) //
+		const ScanKernels& kernels;
+
+		// The table the names of identifiers are added to //
+		SymbolTable& symbols;
+
+		// The states of the lexer that can last over multiple lines //
+		// Everything else is lexed in a single loop so does not need to be stored //
 
-		bool isAlpha : 1 = false;
-		bool isNumeric : 1 = false;
 		bool inComment : 1 = false;
 		bool inStringLiteral : 1 = false;
-		bool isNextCharAlpha : 1 = false;
-		bool isNextCharNumeric : 1 = false;
-		bool wasLastCharAlpha : 1 = false;
-		bool wasLastCharNumeric : 1 = false;
-		bool lexingNumber : 1 = false;
 	};
 }
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <LX-Common.h>
+
+namespace LX
+{
+	// Functions the lexer uses to jump over the bytes it does not need to look at one by one //
+	// Each returns a pointer to the first byte it stopped on, or end if there was none //
+	struct ScanKernels
+	{
+		// Skips spaces, tabs and new lines //
+		const char* (*skipWhitespace)(const char* current, const char* end);
+
+		// Finds the first character that can not be part of a word //
+		const char* (*skipWord)(const char* current, const char* end);
+
+		// Finds the closing # of a comment (or a " as they start string literals within comments) //
+		const char* (*findCommentEnd)(const char* current, const char* end);
+
+		// Finds the closing " of a string literal //
+		const char* (*findStringEnd)(const char* current, const char* end);
+
+		// Finds the first byte that is not part of a valid UTF-8 character //
+		const char* (*validateUTF8)(const char* current, const char* end);
+
+		// Name of the instruction set used by the kernels (used for logging) //
+		const char* name;
+	};
+
+	// The kernels for each instruction set //
+	// The SIMD ones must only be called if the CPU supports their instructions //
+
+	extern const ScanKernels scalarKernels;
+	extern const ScanKernels sse2Kernels;
+	extern const ScanKernels avx2Kernels;
+
+	// Returns the fastest kernels the current CPU supports, worked out the first time it is called //
+	const ScanKernels& GetScanKernels();
+}
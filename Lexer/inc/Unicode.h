@@ -0,0 +1,65 @@
+#pragma once
+
+#include <LX-Common.h>
+
+namespace LX
+{
+	// Returns the length of the UTF-8 character starting at the given byte, or 0 if it is not valid UTF-8 //
+	// Checks everything RFC 3629 requires (no overlong forms, surrogates or code points past U+10FFFF) //
+	inline int UTF8SequenceLength(const unsigned char* current, const unsigned char* end)
+	{
+		const unsigned char lead = current[0];
+		const std::ptrdiff_t left = end - current;
+
+		// ASCII is always a single byte //
+		RETURN_V_IF(1, lead < 0x80);
+
+		// Checks the byte at the offset is a continuation byte within the given range //
+		auto continues = [&](std::ptrdiff_t offset, unsigned char min = 0x80, unsigned char max = 0xBF)
+		{
+			return offset < left && current[offset] >= min && current[offset] <= max;
+		};
+
+		// Two byte characters (C0 and C1 would be overlong) //
+		if (lead >= 0xC2 && lead <= 0xDF)
+		{
+			return continues(1) ? 2 : 0;
+		}
+
+		// Three byte characters, the second byte is limited for E0 (overlong) and ED (surrogates) //
+		if (lead >= 0xE0 && lead <= 0xEF)
+		{
+			const unsigned char min = (lead == 0xE0) ? 0xA0 : 0x80;
+			const unsigned char max = (lead == 0xED) ? 0x9F : 0xBF;
+			return (continues(1, min, max) && continues(2)) ? 3 : 0;
+		}
+
+		// Four byte characters, the second byte is limited for F0 (overlong) and F4 (past U+10FFFF) //
+		if (lead >= 0xF0 && lead <= 0xF4)
+		{
+			const unsigned char min = (lead == 0xF0) ? 0x90 : 0x80;
+			const unsigned char max = (lead == 0xF4) ? 0x8F : 0xBF;
+			return (continues(1, min, max) && continues(2) && continues(3)) ? 4 : 0;
+		}
+
+		// Anything else is a stray continuation byte or can never be in UTF-8 //
+		return 0;
+	}
+
+	// Decodes the UTF-8 character starting at the given byte, which must be valid //
+	// Sets the length to the amount of bytes it takes up //
+	inline char32_t DecodeUTF8(const unsigned char* current, int& length)
+	{
+		const unsigned char lead = current[0];
+
+		if (lead < 0x80) { length = 1; return lead; }
+		if (lead < 0xE0) { length = 2; return ((lead & 0x1F) << 6) | (current[1] & 0x3F); }
+		if (lead < 0xF0) { length = 3; return ((lead & 0x0F) << 12) | ((current[1] & 0x3F) << 6) | (current[2] & 0x3F); }
+
+		length = 4;
+		return ((lead & 0x07) << 18) | ((current[1] & 0x3F) << 12) | ((current[2] & 0x3F) << 6) | (current[3] & 0x3F);
+	}
+
+	// Returns if the (non-ASCII) code point is a letter, so can be part of an identifier //
+	bool IsUnicodeLetter(char32_t codePoint);
+}
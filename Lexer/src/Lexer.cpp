@@ -5,262 +5,595 @@
 #include <LexerErrors.h>
 #include <LexerInfo.h>
 #include <Constants.h>
+#include <Unicode.h>
+
+#include <charconv>
 
 namespace LX
 {
-	// Checks if the given word is a keyword before adding it to the tokens //
-	static void TokenizeWord(const std::string& word, std::vector<Token>& tokens, LexerInfo& info)
+	// Util function to get the class of the character at the given index //
+	static inline CharClass ClassAt(const LexerInfo& info, std::streamsize index)
+	{
+		return charClasses[(unsigned char)info.source[index]];
+	}
+
+	// Moves the lexer past every character of the given class //
+	template<CharClass type>
+	static inline void SkipRun(LexerInfo& info)
 	{
-		// Checks the map for a check and if so adds it with its enum equivalent //
-		if (auto keyword = keywords.find(word); keyword != keywords.end())
+		// Pointers to the current character and the end of the source //
+		const char* start = info.source.data() + info.index;
+		const char* end = info.source.data() + info.len;
+		const char* current = start;
+
+		// Tight loop over the run, nothing else needs to be tracked //
+		while (current != end && charClasses[(unsigned char)*current] == type)
 		{
-			tokens.push_back({ keyword->second, info, (std::streamsize)word.size(), info.source });
+			current++;
 		}
 
-		// Else adds it as a type of IDENTIFIER //
-		else
+		info.index = info.index + (current - start);
+	}
+
+	// Returns the length of the character at the index if it is a letter that is not ASCII, else 0 //
+	static inline int UnicodeLetterAt(const LexerInfo& info, std::streamsize index)
+	{
+		int length = 0;
+		const char32_t codePoint = DecodeUTF8((const unsigned char*)info.source.data() + index, length);
+		return IsUnicodeLetter(codePoint) ? length : 0;
+	}
+
+	// Moves the lexer past a word //
+	static inline void SkipWord(LexerInfo& info)
+	{
+		const char* start = info.source.data() + info.index;
+		const char* end = info.source.data() + info.len;
+
+		while (true)
 		{
-			tokens.push_back({ Token::IDENTIFIER, info, (std::streamsize)word.size(), info.source });
+			// ASCII letters are skipped over by the kernel //
+			info.index = info.index + (info.kernels.skipWord(start, end) - start);
+			RETURN_IF(info.index == info.len || ClassAt(info, info.index) != CharClass::UNICODE);
+
+			// Other letters are looked up one at a time, anything else is the end of the word //
+			const int length = UnicodeLetterAt(info, info.index);
+			RETURN_IF(length == 0);
+
+			info.index = info.index + length;
+			start = info.source.data() + info.index;
 		}
 	}
 
-	static inline void UpdateLexerInfo(LexerInfo& info)
+	// Moves the lexer past whitespace //
+	static inline void SkipWhitespace(LexerInfo& info)
 	{
-		// Transfers the previous state if not at the beginning //
-		if (info.index != 0) [[likely]]
-		{
-			info.wasLastCharAlpha = info.isAlpha;
-			info.wasLastCharNumeric = info.isNumeric;
+		const char* start = info.source.data() + info.index;
+		const char* end = info.source.data() + info.len;
+		info.index = info.index + (info.kernels.skipWhitespace(start, end) - start);
+	}
 
-			info.isAlpha = info.isNextCharAlpha;
-			info.isNumeric = info.isNextCharNumeric;
+	// Adds a token that started at the given index and ends at the current index to the tokens //
+	static inline void AddToken(Token::TokenType type, std::streamsize start, TokenStream& tokens, const LexerInfo& info, SymbolID symbol = NO_SYMBOL)
+	{
+		tokens.Push(type, start, info.index - start, symbol);
+	}
+
+	// Checks if the given word is a keyword before adding it to the tokens //
+	static void TokenizeWord(std::string_view word, std::streamsize start, TokenStream& tokens, LexerInfo& info)
+	{
+		// Checks the table for a keyword and if so adds it with its enum equivalent //
+		if (const KeywordSlot* keyword = FindKeyword(word); keyword != nullptr)
+		{
+			AddToken(keyword->type, start, tokens, info, keyword->symbol);
 		}
 
+		// Else adds it as a type of IDENTIFIER with the ID of its name //
 		else
 		{
-			// Stores the current character for easy access
-			const char current = info.source[info.index];
+			AddToken(Token::IDENTIFIER, start, tokens, info, info.symbols.Intern(word));
+		}
+	}
+
+	// Works out the value of a number literal so it is only converted once //
+	static void TokenizeNumber(std::streamsize start, TokenStream& tokens, const LexerInfo& info)
+	{
+		const char* first = info.source.data() + start;
+		const char* last = info.source.data() + info.index;
 
-			// Works out if the current character is alphabetic or numeric //
-			info.isAlpha = (current >= 'a' && current <= 'z') || (current >= 'A' && current <= 'Z');
-			info.isNumeric = (current >= '0' && current <= '9') || (current == '.');
+		NumberValue value = {};
+		std::from_chars_result result = {};
+
+		// Numbers with a decimal point are doubles, every other number is a 32-bit int //
+		if (std::find(first, last, '.') != last)
+		{
+			value.kind = NumberValue::DECIMAL;
+			result = std::from_chars(first, last, value.decimal);
 		}
 
-		// Only does next character checks when not at the end //
-		if (info.index + 1 < info.len) [[likely]]
+		else
 		{
-			// Gets the next character //
-			const char next = info.source[info.index + 1];
+			value.kind = NumberValue::INTEGER;
+			result = std::from_chars(first, last, value.integer);
+		}
 
-			// Sets flags depending on the value of the next character //
-			info.isNextCharAlpha = (next >= 'a' && next <= 'z') || (next >= 'A' && next <= 'Z');
-			info.isNextCharNumeric = (next >= '0' && next <= '9') || (next == '.');
+		// The whole literal has to be a single number that fits within its type //
+		ThrowIf<InvalidNumberLiteral>(result.ec != std::errc() || result.ptr != last, info, start, result.ec == std::errc::result_out_of_range);
+		tokens.PushNumber(start, info.index - start, value);
+	}
+
+	// Skips over the body of a comment //
+	// Stops at the closing # or at a " as they start a string literal, even within comments //
+	static inline void LexComment(LexerInfo& info)
+	{
+		// Looks for the first character that changes the state //
+		const char* start = info.source.data() + info.index;
+		const char* end = info.source.data() + info.len;
+		const char* current = info.kernels.findCommentEnd(start, end);
+
+		info.index = info.index + (current - start);
+		RETURN_IF(current == end);
+
+		// Start of a string literal //
+		if (*current == '"')
+		{
+			info.startOfStringLiteral = info.index;
+			info.inStringLiteral = true;
 		}
 
-		// Else defaults the flags to false //
+		// End of the comment //
 		else
 		{
-			info.isNextCharAlpha = false;
-			info.isNextCharNumeric = false;
+			info.inComment = false;
 		}
+
+		// Moves past the character that changed the state //
+		info.index++;
 	}
 
-	const std::vector<Token> LX::LexicalAnalyze(const std::filesystem::path& path)
+	// Skips over the body of a string literal and adds it to the tokens once it ends //
+	static inline void LexStringLiteral(LexerInfo& info, TokenStream& tokens)
 	{
-		// Logs that the file is being read //
-		Log::LogNewSection("Reading file: ", path.string());
+		// Looks for the closing quote //
+		const char* start = info.source.data() + info.index;
+		const char* end = info.source.data() + info.len;
+		const char* close = info.kernels.findStringEnd(start, end);
 
-		std::string fileContents = ReadFileToString(path);
-		const std::streamsize len = fileContents.length();
+		info.index = info.index + (close - start);
 
-		// Logs the start of the lexical analysis
-		Log::LogNewSection("Lexing file");
+		// Does not create a token if the string literal is never closed //
+		RETURN_IF(close == end);
+
+		// Moves past the closing quote //
+		info.index++;
+		info.inStringLiteral = false;
+
+		AddToken(Token::STRING_LITERAL, info.startOfStringLiteral, tokens, info);
+	}
+
+	// Lexes the next part of the source, which is either a token or a run of something that is skipped over //
+	static inline void LexStep(LexerInfo& info, TokenStream& tokens)
+	{
+		// String literals take priority over comments as they can be started within them //
+		if (info.inStringLiteral)
+		{
+			LexStringLiteral(info, tokens);
+			return;
+		}
+
+		// Skips over the comment (or until a string literal is started within it) //
+		if (info.inComment)
+		{
+			LexComment(info);
+			return;
+		}
 
-		// Allocates a large ammount of memory to hold the output //
-		// Will shrink the size later on to stop excess memory being allocated //
-		std::vector<Token> tokens = {};
-		tokens.reserve(0xFFFF);
+		// Stores the start of the token that is about to be lexed //
+		const std::streamsize start = info.index;
 
-		// Trackers for when the program is iterating over the file //
-		LexerInfo info(fileContents);
+		// The class of the current character decides what the next state is //
+		switch (ClassAt(info, info.index))
+		{
+			// Letters that are not ASCII can also start words, other characters are invalid //
+			case CharClass::UNICODE:
+				ThrowIf<InvalidCharInSource>(UnicodeLetterAt(info, info.index) == 0, info);
+				[[fallthrough]];
+
+			// Words are either keywords or identifiers //
+			case CharClass::ALPHA:
+				SkipWord(info);
+				TokenizeWord(info.source.substr(start, info.index - start), start, tokens, info);
+				break;
+
+			// Number literals are converted to their value as they are added //
+			case CharClass::NUMERIC:
+				SkipRun<CharClass::NUMERIC>(info);
+				TokenizeNumber(start, tokens, info);
+				break;
+
+			// Start of a string literal //
+			case CharClass::QUOTE:
+				info.startOfStringLiteral = info.index;
+				info.inStringLiteral = true;
+				info.index++;
+				break;
+
+			// Start of a comment //
+			case CharClass::HASH:
+				info.inComment = true;
+				info.index++;
+				break;
+
+			// Symbols and operators are a token each //
+			case CharClass::SINGLE_CHAR_TOKEN:
+				info.index++;
+				AddToken(singleCharTokens[(unsigned char)info.source[start]], start, tokens, info);
+				break;
+
+			// Whitespace is skipped over //
+			case CharClass::SPACE:
+			case CharClass::TAB:
+			case CharClass::NEW_LINE:
+				SkipWhitespace(info);
+				break;
+
+			// Throws an error with all the relevant information //
+			default:
+				ThrowIf<InvalidCharInSource>(true, info);
+		}
+	}
 
+	// Lexes the source from the index of the info up to its length, adding the tokens it finds //
+	static void LexRange(LexerInfo& info, TokenStream& tokens)
+	{
 		// Iterates over the file and turns it into tokens //
-		while (info.index < len)
+		// Each state is handled by its own step, which returns here when the state ends //
+		while (info.index < info.len)
 		{
-			// Stores the current character for easy access
-			const char current = info.source[info.index];
+			LexStep(info, tokens);
+		}
+	}
 
-			// Updates the LexerInfo //
-			UpdateLexerInfo(info);
+	// Checks the part of the source from begin up to end is valid UTF-8 //
+	// Both have to be at the start of a character (or the end of the source) //
+	static void ValidateUTF8(const SourceManager& sources, FileID file, std::streamsize begin, std::streamsize end)
+	{
+		const std::string_view source = sources.SourceOf(file);
+		const char* invalid = GetScanKernels().validateUTF8(source.data() + begin, source.data() + end);
 
-			// Updates string literal tracker and skips over rest if in a string literal //
-			if (current == '"')
-			{
-				// Start of string literal //
-				if (info.inStringLiteral == false)
-				{
-					// Updates the neccesarry trackers //
-					info.startOfStringLiteral = info.index + 1;
-					info.inStringLiteral = true;
-				}
-
-				// End of string literal //
-				else
-				{
-					// Adds the string literal token to the token vector //
-					std::string lit(info.source.data() + info.startOfStringLiteral, info.index - info.startOfStringLiteral);
-					tokens.push_back({ Token::STRING_LITERAL, info, (std::streamsize)lit.length() + 2, info.source }); // Adding two makes the "" be stored as well
-
-					// Updates trackers //
-					info.inStringLiteral = false;
-				}
-			}
+		// The byte is only read if it is invalid as the index is past the end of the source when it is all valid //
+		const std::streamsize index = invalid - source.data();
+		ThrowIf<InvalidUTF8InSource>(index != end, sources, sources.LocationOf(file, index), index != end ? (unsigned char)source[index] : 0);
+	}
 
-			// Skips over rest if within a string literal //
-			else if (info.inStringLiteral);
+	// --- Parallel lexing --- //
+	// The only states that can last over multiple lines are comments and strings //
+	// So the source is split into chunks and what each chunk does to those states is worked out in parallel //
+	// Walking over those in order gives the state each chunk starts in so they can be lexed in parallel //
 
-			// Updates comment state //
-			else if (current == '#')
-			{
-				info.inComment = !info.inComment;
-			}
+	// Files smaller than this are lexed on a single thread as starting the threads would take longer //
+	static constexpr std::streamsize PARALLEL_LEXING_THRESHOLD = 0x100000;
+
+	// The states the lexer can be in at the start of a chunk //
+	enum class ChunkState : unsigned char
+	{
+		NORMAL,
+		COMMENT,
+		STRING_LITERAL,
+		STRING_LITERAL_IN_COMMENT,
 
-			// Skips over if within a comment //
-			else if (info.inComment);
+		COUNT // <- Not a state, the amount of states
+	};
 
-			// Start of a number //
-			else if (info.isNumeric == true && info.wasLastCharNumeric == false && info.lexingNumber == false)
+	// The state the lexer is in at the end of a chunk for each state it could have been in at the start of it //
+	using ChunkSummary = std::array<ChunkState, (size_t)ChunkState::COUNT>;
+
+	// Part of the source that starts in the NORMAL state, it is lexed on its own by one thread //
+	struct LexingUnit
+	{
+		std::streamsize start;
+		std::streamsize end;
+	};
+
+	// Goes over a chunk the same way the lexer would, but only looking for the changes in state //
+	static ChunkState ScanChunk(const ScanKernels& kernels, const char* current, const char* end, ChunkState state)
+	{
+		while (current != end)
+		{
+			// Finds the next character that can change the state //
+			const bool inString = state == ChunkState::STRING_LITERAL || state == ChunkState::STRING_LITERAL_IN_COMMENT;
+			const char* next = inString ? kernels.findStringEnd(current, end) : kernels.findCommentEnd(current, end);
+			RETURN_V_IF(state, next == end);
+
+			// Works out the new state from the current one and the character found //
+			switch (state)
 			{
-				// Stores the start of the number //
-				info.startOfNumberLiteral = info.index;
-
-				// Checks if it as the end (single char numbers) //
-				if (info.isNextCharNumeric == false)
-				{
-					// Pushes the number to the token vector. Number literals are stored as string in the tokens //
-					std::string num(info.source.data() + info.startOfNumberLiteral, (unsigned __int64)(info.index + 1) - info.startOfNumberLiteral);
-					tokens.push_back({ Token::NUMBER_LITERAL, info, (std::streamsize)num.size(), info.source });
-				}
-
-				// Stores it is lexing a number literal //
-				else { info.lexingNumber = true; }
+				case ChunkState::NORMAL:
+					state = (*next == '#') ? ChunkState::COMMENT : ChunkState::STRING_LITERAL;
+					break;
+
+				case ChunkState::COMMENT:
+					state = (*next == '#') ? ChunkState::NORMAL : ChunkState::STRING_LITERAL_IN_COMMENT;
+					break;
+
+				case ChunkState::STRING_LITERAL:
+					state = ChunkState::NORMAL;
+					break;
+
+				case ChunkState::STRING_LITERAL_IN_COMMENT:
+					state = ChunkState::COMMENT;
+					break;
 			}
 
-			// End of a number //
-			else if (info.isNumeric == true && info.isNextCharNumeric == false && info.lexingNumber == true)
+			current = next + 1;
+		}
+
+		return state;
+	}
+
+	// Lexes the source on multiple threads, the tokens are identical to lexing it on one //
+	static void LexInParallel(const SourceManager& sources, FileID file, TokenStream& tokens, SymbolTable& symbols, unsigned threads)
+	{
+		const std::string_view source = sources.SourceOf(file);
+		const std::streamsize len = source.length();
+
+		// Splits the source into a chunk per thread //
+		// Each chunk starts after a new line so no token outside of a comment or string is split between two //
+
+		std::vector<std::streamsize> starts = { 0 };
+		for (unsigned i = 1; i < threads; i++)
+		{
+			const size_t newLine = source.find('\n', std::max(starts.back(), (len / threads) * i));
+			if (newLine == std::string_view::npos || (std::streamsize)newLine + 1 == len) { break; }
+
+			starts.push_back(newLine + 1);
+		}
+
+		const size_t chunkCount = starts.size();
+		starts.push_back(len); // <- Makes the end of each chunk the start of the next one
+
+		// Works out what each chunk does to every state it could start in //
+		const ScanKernels& kernels = GetScanKernels();
+		std::vector<ChunkSummary> summaries(chunkCount);
+
+		// Each chunk is also checked to be valid UTF-8, no character is split between two as they start after a new line //
+		std::vector<const char*> invalidUTF8(chunkCount);
+
+		ParallelFor(chunkCount, threads, [&](size_t i)
+		{
+			invalidUTF8[i] = kernels.validateUTF8(source.data() + starts[i], source.data() + starts[i + 1]);
+
+			for (size_t state = 0; state < (size_t)ChunkState::COUNT; state++)
 			{
-				// Pushes the number to the token vector. Number literals are stored as string in the tokens //
-				std::string num(info.source.data() + info.startOfNumberLiteral, (unsigned __int64)(info.index + 1) - info.startOfNumberLiteral);
-				tokens.push_back({ Token::NUMBER_LITERAL, info, (std::streamsize)num.size(), info.source });
-				info.lexingNumber = false; // Stops storing it is lexing a number
+				summaries[i][state] = ScanChunk(kernels, source.data() + starts[i], source.data() + starts[i + 1], (ChunkState)state);
 			}
+		});
+
+		// Throws for the first invalid byte within the source as that is the one a single thread would have found //
+		for (size_t i = 0; i < chunkCount; i++)
+		{
+			const std::streamsize index = invalidUTF8[i] - source.data();
+			ThrowIf<InvalidUTF8InSource>(index != starts[i + 1], sources, sources.LocationOf(file, index), index != starts[i + 1] ? (unsigned char)source[index] : 0);
+		}
+
+		// Walks over the chunks to find the state each one starts in //
+		// Chunks not starting in the NORMAL state are joined onto the one before as a token is split between them //
 
-			// During a number //
-			else if (info.isNumeric == true);
-			else if (info.lexingNumber == true);
+		std::vector<LexingUnit> units;
+		ChunkState state = ChunkState::NORMAL;
+
+		for (size_t i = 0; i < chunkCount; i++)
+		{
+			if (state == ChunkState::NORMAL) { units.push_back({ starts[i], starts[i + 1] }); }
+			else { units.back().end = starts[i + 1]; }
 
-			// Start of a word //
-			else if (info.isAlpha == true && info.wasLastCharAlpha == false)
+			state = summaries[i][(size_t)state];
+		}
+
+		// Lexes each unit on its own thread //
+		// Errors are stored so they can be rethrown on this thread //
+		// Each unit adds its names to its own symbol table as they are not thread-safe //
+
+		std::vector<TokenStream> unitTokens(units.size(), TokenStream(source, sources.StartOf(file)));
+		std::vector<SymbolTable> unitSymbols(units.size());
+		std::vector<std::exception_ptr> errors(units.size());
+
+		ParallelFor(units.size(), threads, [&](size_t i)
+		{
+			try
 			{
-				// Stores the start of the word //
-				info.startOfWord = info.index;
-
-				// Checks if it is at the end (single char words) //
-				if (info.isNextCharAlpha == false)
-				{
-					// Calls the function designed to handle the tokenisation of words //
-					TokenizeWord({ info.source.data() + info.startOfWord, 1 }, tokens, info);
-				}
+				LexerInfo info(sources, file, unitSymbols[i], units[i].start, units[i].end);
+				unitTokens[i].ReserveFor(units[i].end - units[i].start);
+				LexRange(info, unitTokens[i]);
 			}
 
-			// End of a word //
-			else if (info.isAlpha == true && info.isNextCharAlpha == false)
+			catch (...)
 			{
-				// Calls the function designed to handle the tokenisation of words //
-				TokenizeWord({ info.source.data() + info.startOfWord, (unsigned __int64)((info.index + 1) - info.startOfWord) }, tokens, info);
+				errors[i] = std::current_exception();
 			}
+		});
 
-			// During a word //
-			else if (info.isAlpha == true);
+		// Rethrows the first error within the source as that is the one the lexer would have found on one thread //
+		for (const std::exception_ptr& error : errors)
+		{
+			if (error != nullptr) { std::rethrow_exception(error); }
+		}
 
-			// Symbols //
-			else if (auto sym = symbols.find(current); sym != symbols.end())
+		// Joins the tokens of each unit in order //
+		for (size_t i = 0; i < units.size(); i++)
+		{
+			// Adds the names of the unit to the main table //
+			// Done in order of the units and their IDs so the IDs are the same as lexing on one thread //
+			std::vector<SymbolID> remap(unitSymbols[i].Size());
+			for (SymbolID id = 0; id < remap.size(); id++)
 			{
-				tokens.push_back({ sym->second, info, 1, info.source });
+				remap[id] = symbols.Intern(unitSymbols[i].NameOf(id));
 			}
 
-			// Operators (+, -, /, *) //
-			else if (auto op = operators.find(current); op != operators.end())
+			// Copies the tokens with the IDs of the main table //
+			// Number literals store the index of their value instead of an ID so are not remapped //
+			const TokenStream& unit = unitTokens[i];
+			for (size_t t = 0; t < unit.Size(); t++)
 			{
-				tokens.push_back({ op->second, info, 1, info.source });
+				const bool named = unit.SymbolAt(t) != NO_SYMBOL && unit.TypeAt(t) != Token::NUMBER_LITERAL;
+				tokens.PushCopy(unit, t, 0, named ? remap[unit.SymbolAt(t)] : NO_SYMBOL);
 			}
+		}
+	}
 
-			// If it is here and not whitespace that means it's an invalid character //
-			else if (current == ' ' || current == '\r');
+	FileTokens LexicalAnalyze(const SourceManager& sources, FileID file, unsigned threads)
+	{
+		ScopedEvent event("LexicalAnalyze");
 
-			// Skips over an extra 3 spaces as tabs SHOULD ALWAYS take up 4 spaces //
-			// Only for the column and not index //
-			else if (current == '\t')
-			{
-				info.column = info.column + 3;
-			}
+		// Logs that the file is being read //
+		LX_LOG_SECTION("Reading file: ", sources.PathOf(file).string());
+
+		// The tokens view into the source owned by the SourceManager //
+		FileTokens output;
+		output.file = file;
 
-			// Increments the line number and resets the column on entering a new line //
-			else if (current == '\n')
+		// Reserves the space for the tokens from the size of the file //
+		const std::string_view source = sources.SourceOf(file);
+		output.tokens = TokenStream(source, sources.StartOf(file));
+		output.tokens.ReserveFor(source.length());
+		TokenStream& tokens = output.tokens;
+
+		// Logs the start of the lexical analysis
+		LX_LOG_SECTION("Lexing file");
+		LX_LOG(LOW, "Scanning with ", GetScanKernels().name, " kernels");
+
+		// Small files are lexed on a single thread //
+		if (threads <= 1 || (std::streamsize)source.length() < PARALLEL_LEXING_THRESHOLD)
+		{
+			// The whole source is checked to be UTF-8 before it is lexed //
+			ValidateUTF8(sources, file, 0, source.length());
+
+			// Trackers for when the program is iterating over the file //
+			LexerInfo info(sources, file, output.symbols);
+			LexRange(info, tokens);
+		}
+
+		// Else splits the work over the threads //
+		else
+		{
+			LX_LOG(LOW, "Lexing on ", threads, " threads");
+			LexInParallel(sources, file, tokens, output.symbols, threads);
+		}
+
+		LX_LOG(LOW, "\n"); // Puts a space to clean up the log
+
+		// Binary traces store the source once and where each token is within it //
+		if constexpr (Log::TRACING)
+		{
+			Log::Event<Log::Priority::HIGH>({ TraceEventType::SOURCE }, tokens.Source());
+
+			for (int i = 0; i < tokens.Size(); i++)
 			{
-				info.column = 0;
-				info.line++;
+				const Token token = tokens.At(i);
+				Log::Event<Log::Priority::HIGH>({ TraceEventType::TOKEN, (uint8_t)token.type, 0, (uint32_t)i, ((uint64_t)token.index << 32) | (uint32_t)token.length });
 			}
+		}
 
-			// Throws an error with all the relevant information //
-			else
+		// Else only goes over the tokens if they are going to be logged //
+		else if (Log::IsEnabled<Log::Priority::HIGH>())
+		{
+			for (int i = 0; i < tokens.Size(); i++)
 			{
-				ThrowIf<InvalidCharInSource>(true, info, path.string());
+				const Token token = tokens.At(i);
+
+				LX_LOG
+				(
+					HIGH,
+					std::left,
+					"T-Index: ", std::setw(5), i,
+					" { Index: ", std::setw(3), token.index,
+					", Length: ", std::setw(2), token.length, " } ",
+					std::setw(30), ToString(token.type) + ":", "{", token.GetContents(), "}"
+				);
 			}
-
-			// Log dumps A LOT of info //
-
-			Log::out
-			(
-				"Index: ", std::left, std::setw(3), info.index,
-				" Is Alpha: ", info.isAlpha,
-				" Is Numeric: ", info.isNumeric,
-				" In Comment: ", info.inComment,
-				" In String: ", info.inStringLiteral,
-				" Next Char Alpha: ", info.isNextCharAlpha,
-				" Next Char Numeric: ", info.wasLastCharNumeric,
-				" Last Char Numeric: ", info.wasLastCharAlpha,
-				" Lexing number: ", info.lexingNumber,
-				" Current: {", CharAsStrLit(current), "}"
-			);
-
-			// Updates the indecies to the next character //
-
-			info.index++;
-			info.column++;
 		}
 
-		Log::out("\n"); // Puts a space to clean up the log
+		LX_LOG(LOW, "End of tokens");
+		return output;
+	}
+
+	// --- Incremental lexing --- //
+
+	TokenStream RelexAfterEdit(const TokenStream& oldTokens, const SourceManager& sources, FileID newFile, const SourceEdit& edit, SymbolTable& symbols)
+	{
+		const std::string_view oldSource = oldTokens.Source();
+		const std::string_view newSource = sources.SourceOf(newFile);
+
+		// How far everything after the edit has moved //
+		const std::streamsize shift = edit.newEnd - edit.oldEnd;
 
-		for (int i = 0; i < tokens.size(); i++)
+		// Checks the edit is within both sources and the new source is the old one with the edit applied //
+		ThrowIf<InvalidSourceEdit>
+		(
+			edit.start < 0 || edit.start > edit.oldEnd || edit.start > edit.newEnd ||
+			edit.oldEnd > (std::streamsize)oldSource.length() ||
+			(std::streamsize)newSource.length() != (std::streamsize)oldSource.length() + shift
+		);
+
+		// The old source was valid UTF-8 so only the characters the edit touched need to be checked //
+		// Starts at the character before the edit (it may have lost the end of it) and ends past the rest of the last character //
+
+		std::streamsize validateStart = std::max<std::streamsize>(edit.start - 1, 0);
+		while (validateStart > 0 && ((unsigned char)newSource[validateStart] & 0xC0) == 0x80) { validateStart--; }
+
+		std::streamsize validateEnd = edit.newEnd;
+		while (validateEnd < (std::streamsize)newSource.length() && ((unsigned char)newSource[validateEnd] & 0xC0) == 0x80) { validateEnd++; }
+
+		ValidateUTF8(sources, newFile, validateStart, validateEnd);
+
+		// Finds the last token before the edit that the lexer can restart at //
+		// The lexer is always in its normal state at the start of a token that is not a string literal //
+		// The token has to start before the edit as the token before it ended depending on its first character //
+
+		size_t restart = oldTokens.FindTokenAt(edit.start);
+		while (restart != 0 && oldTokens.TypeAt(restart - 1) == Token::STRING_LITERAL) { restart--; }
+
+		const bool fromStart = restart == 0;
+		if (fromStart == false) { restart--; }
+
+		// Every token before the restart is the same, the new stream views into the new source //
+		TokenStream tokens(newSource, sources.StartOf(newFile));
+		tokens.ReserveFor(newSource.length());
+
+		for (size_t i = 0; i < restart; i++)
 		{
-			Token& token = tokens[i];
-
-			Log::out<Log::Priority::HIGH>
-			(
-				std::left,
-				"T-Index: ", std::setw(5), i,
-				" { Line: ", std::setw(3), token.line,
-				", Index: ", std::setw(3), token.index,
-				", Length: ", std::setw(2), token.length, " } ",
-				std::setw(30), ToString(token.type) + ":", "{", token.GetContents(), "}"
-			);
+			tokens.PushCopy(oldTokens, i, 0, oldTokens.SymbolAt(i));
 		}
 
-		Log::out("End of tokens");
+		// Starts the lexer from the beginning or where it was at the start of the restart token //
+		LexerInfo info(sources, newFile, symbols, fromStart ? 0 : oldTokens.IndexAt(restart), newSource.length());
+
+		while (info.index < info.len)
+		{
+			// Lexes until a new token is created //
+			const size_t tokenCount = tokens.Size();
+			LexStep(info, tokens);
+			if (tokens.Size() == tokenCount) { continue; }
+
+			// Only tokens after the edit that are not string literals can line up with the old tokens //
+			const size_t last = tokens.Size() - 1;
+			if (tokens.IndexAt(last) < edit.newEnd || tokens.TypeAt(last) == Token::STRING_LITERAL) { continue; }
+
+			// Looks for an old token that started in the same place before the edit //
+			size_t old = oldTokens.FindTokenAt(tokens.IndexAt(last) - shift, restart);
+			if (old == oldTokens.Size() || oldTokens.IndexAt(old) != tokens.IndexAt(last) - shift || oldTokens.TypeAt(old) == Token::STRING_LITERAL) { continue; }
+
+			// Both lexers were in the normal state at the start of the token with the same source after it //
+			// So every token from here on is the old one moved by the edit (the new token is the moved old one) //
+
+			for (old = old + 1; old < oldTokens.Size(); old++)
+			{
+				tokens.PushCopy(oldTokens, old, shift, oldTokens.SymbolAt(old));
+			}
+
+			return tokens;
+		}
 
-		// Shrinks the vector down to minimum size before returning to avoid excess memory being allocated
-		tokens.shrink_to_fit();
+		// The lexer reached the end of the source without lining up with the old tokens //
 		return tokens;
 	}
-}
\ No newline at end of file
+}
@@ -3,30 +3,38 @@
 #include <LexerErrors.h>
 
 #include <LexerInfo.h>
+#include <Unicode.h>
 
 namespace LX
 {
-	InvalidCharInSource::InvalidCharInSource(const LexerInfo& info, const std::string _file)
-		: col(info.column), line(info.line), file(_file), lineContents(GetLineAtIndexOf(info.source, info.index)), invalid(info.source[info.index])
-	{}
+	InvalidCharInSource::InvalidCharInSource(const LexerInfo& info)
+		: sources(info.sources), location({ info.start.raw + (uint32_t)info.index })
+	{
+		// The source has already been checked to be UTF-8 so the whole character can be copied //
+		const unsigned char* character = (const unsigned char*)info.source.data() + info.index;
+		invalid = std::string((const char*)character, UTF8SequenceLength(character, (const unsigned char*)info.source.data() + info.source.length()));
+	}
 
 	void InvalidCharInSource::PrintToConsole() const
 	{
+		// Works out where the character is //
+		const ResolvedLocation resolved = sources.Resolve(location);
+
 		// Calculates the length of the line number in the console so it is formatted correctly //
 		std::ostringstream oss;
-		oss << std::setw(3) << line;
+		oss << std::setw(3) << resolved.line;
 		size_t lineNumberWidthInConsole = std::max(oss.str().size(), (size_t)3);
 
 		// Prints the error with the relevant information to the console //
 		std::cout << "\n";
 		PrintAsColor<Color::LIGHT_RED>("Error: ");
 		std::cout << "Invalid character found in ";
-		PrintAsColor<Color::WHITE>(file);
+		PrintAsColor<Color::WHITE>(sources.PathOf(resolved.file).string());
 		std::cout << " {";
-		PrintAsColor<Color::LIGHT_RED>(std::string(1, invalid));
+		PrintAsColor<Color::LIGHT_RED>(invalid);
 		std::cout << "}:\n";
-		std::cout << "Line: " << std::setw(lineNumberWidthInConsole) << line << " | " << lineContents << "\n";
-		std::cout << "      " << std::setw(lineNumberWidthInConsole) << "" << " | " << std::setw(col - 1) << "";
+		std::cout << "Line: " << std::setw(lineNumberWidthInConsole) << resolved.line << " | " << resolved.lineContents << "\n";
+		std::cout << "      " << std::setw(lineNumberWidthInConsole) << "" << " | " << std::setw(resolved.column - 1) << "";
 		PrintAsColor<Color::LIGHT_RED>("^");
 		std::cout << "\n";
 	}
@@ -35,4 +43,109 @@ namespace LX
 	{
 		return "Invalid char in source";
 	}
+
+	InvalidUTF8InSource::InvalidUTF8InSource(const SourceManager& _sources, SourceLocation _location, unsigned char _byte)
+		: sources(_sources), location(_location), byte(_byte)
+	{}
+
+	void InvalidUTF8InSource::PrintToConsole() const
+	{
+		// Works out where the byte is //
+		const ResolvedLocation resolved = sources.Resolve(location);
+
+		// Formats the byte as hex as it can not be printed as a character //
+		std::ostringstream hex;
+		hex << "0x" << std::hex << std::uppercase << std::setw(2) << std::setfill('0') << (unsigned)byte;
+
+		// Prints the error with the relevant information to the console //
+		// The line is not printed as it can not be shown correctly if it is not valid UTF-8 //
+		std::cout << "\n";
+		PrintAsColor<Color::LIGHT_RED>("Error: ");
+		std::cout << "Source is not valid UTF-8 in ";
+		PrintAsColor<Color::WHITE>(sources.PathOf(resolved.file).string());
+		std::cout << " {";
+		PrintAsColor<Color::LIGHT_RED>(hex.str());
+		std::cout << "}:\n";
+		std::cout << "Line: " << resolved.line << ", Column: " << resolved.column << "\n";
+	}
+
+	const char* InvalidUTF8InSource::ErrorType() const
+	{
+		return "Invalid UTF-8 in source";
+	}
+
+	InvalidNumberLiteral::InvalidNumberLiteral(const LexerInfo& info, std::streamsize start, bool _outOfRange)
+		: sources(info.sources), location({ info.start.raw + (uint32_t)start }), literal(info.source.substr(start, info.index - start)), outOfRange(_outOfRange)
+	{}
+
+	void InvalidNumberLiteral::PrintToConsole() const
+	{
+		// Works out where the literal is //
+		const ResolvedLocation resolved = sources.Resolve(location);
+
+		// Calculates the length of the line number in the console so it is formatted correctly //
+		std::ostringstream oss;
+		oss << std::setw(3) << resolved.line;
+		size_t lineNumberWidthInConsole = std::max(oss.str().size(), (size_t)3);
+
+		// Prints the error with the relevant information to the console //
+		std::cout << "\n";
+		PrintAsColor<Color::LIGHT_RED>("Error: ");
+		std::cout << (outOfRange ? "Number literal is too large in " : "Invalid number literal in ");
+		PrintAsColor<Color::WHITE>(sources.PathOf(resolved.file).string());
+		std::cout << " {";
+		PrintAsColor<Color::LIGHT_RED>(literal);
+		std::cout << "}:\n";
+
+		// Tells the user the range of the type if that is why it is invalid //
+		if (outOfRange && literal.find('.') == std::string::npos)
+		{
+			std::cout << "Whole numbers must be between " << INT32_MIN << " and " << INT32_MAX << "\n";
+		}
+
+		// Prints the code with the error to the console //
+		std::string errorSquiggle(literal.length(), '~');
+		std::cout << "Line: " << std::setw(lineNumberWidthInConsole) << resolved.line << " | " << resolved.lineContents << "\n";
+		std::cout << "      " << std::setw(lineNumberWidthInConsole) << "" << " | " << std::setw(resolved.column - 1) << "";
+		PrintAsColor<Color::LIGHT_RED>(errorSquiggle);
+		std::cout << "\n";
+	}
+
+	const char* InvalidNumberLiteral::ErrorType() const
+	{
+		return "Invalid number literal";
+	}
+
+	void InvalidSourceEdit::PrintToConsole() const
+	{
+		// Tells the user the edit was out of range and how to fix it //
+		std::cout << "\n";
+		PrintAsColor<Color::LIGHT_RED>("Error: ");
+		std::cout << "Edit given to the lexer does not match the old and new sources\n";
+		std::cout << "Make sure the edit is within both sources and the new source is the old one with the edit applied\n";
+	}
+
+	const char* InvalidSourceEdit::ErrorType() const
+	{
+		return "Invalid source edit";
+	}
+
+	SourceTooLarge::SourceTooLarge(const std::string _file)
+		: file(_file)
+	{}
+
+	void SourceTooLarge::PrintToConsole() const
+	{
+		// Tells the user the file is too large and what the limit is //
+		std::cout << "\n";
+		PrintAsColor<Color::LIGHT_RED>("Error: ");
+		std::cout << "Source file ";
+		PrintAsColor<Color::WHITE>(file);
+		std::cout << " is too large, all the files being compiled must add up to less than 4GB\n";
+	}
+
+	const char* SourceTooLarge::ErrorType() const
+	{
+		return "Source too large";
+	}
 }
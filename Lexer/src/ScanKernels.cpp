@@ -0,0 +1,273 @@
+#include <LX-Common.h>
+
+#include <ScanKernels.h>
+#include <Unicode.h>
+
+#include <intrin.h>
+#include <bit>
+
+namespace LX
+{
+	// --- Scalar kernels, used on CPUs without SIMD support and for the bytes at the end of the source --- //
+
+	static const char* SkipWhitespaceScalar(const char* current, const char* end)
+	{
+		while (current != end && (*current == ' ' || *current == '\t' || *current == '\n' || *current == '\r'))
+		{
+			current++;
+		}
+
+		return current;
+	}
+
+	static const char* SkipWordScalar(const char* current, const char* end)
+	{
+		while (current != end && ((*current >= 'a' && *current <= 'z') || (*current >= 'A' && *current <= 'Z')))
+		{
+			current++;
+		}
+
+		return current;
+	}
+
+	static const char* FindCommentEndScalar(const char* current, const char* end)
+	{
+		while (current != end && *current != '#' && *current != '"')
+		{
+			current++;
+		}
+
+		return current;
+	}
+
+	static const char* FindStringEndScalar(const char* current, const char* end)
+	{
+		while (current != end && *current != '"')
+		{
+			current++;
+		}
+
+		return current;
+	}
+
+	static const char* ValidateUTF8Scalar(const char* current, const char* end)
+	{
+		const unsigned char* bytes = (const unsigned char*)current;
+		const unsigned char* last = (const unsigned char*)end;
+
+		while (bytes != last)
+		{
+			const int length = UTF8SequenceLength(bytes, last);
+			RETURN_V_IF((const char*)bytes, length == 0);
+
+			bytes = bytes + length;
+		}
+
+		return end;
+	}
+
+	// --- Wrappers over the instructions of each SIMD instruction set so the kernels can be shared --- //
+	// Each comparison returns a bitmask with one bit per byte that matched //
+
+	struct SSE2
+	{
+		using Vec = __m128i;
+
+		static constexpr std::streamsize WIDTH = 16;
+		static constexpr uint32_t ALL = 0xFFFF;
+
+		static Vec Load(const char* ptr) { return _mm_loadu_si128((const __m128i*)ptr); }
+
+		static uint32_t Equals(Vec v, char c) { return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(c))); }
+
+		// The bytes that are not ASCII have their top bit set //
+		static uint32_t NonASCII(Vec v) { return (uint32_t)_mm_movemask_epi8(v); }
+
+		// Lowercases the bytes and shifts 'a' to -128 so a single signed compare finds [a-z] //
+		static uint32_t Alpha(Vec v)
+		{
+			const Vec shifted = _mm_add_epi8(_mm_or_si128(v, _mm_set1_epi8(0x20)), _mm_set1_epi8((char)(128 - 'a')));
+			return (uint32_t)_mm_movemask_epi8(_mm_cmplt_epi8(shifted, _mm_set1_epi8((char)(-128 + 26))));
+		}
+	};
+
+	struct AVX2
+	{
+		using Vec = __m256i;
+
+		static constexpr std::streamsize WIDTH = 32;
+		static constexpr uint32_t ALL = 0xFFFFFFFF;
+
+		static Vec Load(const char* ptr) { return _mm256_loadu_si256((const __m256i*)ptr); }
+
+		static uint32_t Equals(Vec v, char c) { return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(c))); }
+
+		// The bytes that are not ASCII have their top bit set //
+		static uint32_t NonASCII(Vec v) { return (uint32_t)_mm256_movemask_epi8(v); }
+
+		// Lowercases the bytes and shifts 'a' to -128 so a single signed compare finds [a-z] //
+		static uint32_t Alpha(Vec v)
+		{
+			const Vec shifted = _mm256_add_epi8(_mm256_or_si256(v, _mm256_set1_epi8(0x20)), _mm256_set1_epi8((char)(128 - 'a')));
+			return (uint32_t)_mm256_movemask_epi8(_mm256_cmpgt_epi8(_mm256_set1_epi8((char)(-128 + 26)), shifted));
+		}
+	};
+
+	// --- SIMD kernels, the bytes that do not fill a full vector are left to the scalar kernels --- //
+
+	template<typename ISA>
+	static const char* SkipWhitespaceSIMD(const char* current, const char* end)
+	{
+		while (end - current >= ISA::WIDTH)
+		{
+			const typename ISA::Vec bytes = ISA::Load(current);
+			const uint32_t whitespace = ISA::Equals(bytes, ' ') | ISA::Equals(bytes, '\t') | ISA::Equals(bytes, '\n') | ISA::Equals(bytes, '\r');
+
+			const uint32_t stops = ~whitespace & ISA::ALL;
+			RETURN_V_IF(current + std::countr_zero(stops), stops != 0);
+
+			current = current + ISA::WIDTH;
+		}
+
+		return SkipWhitespaceScalar(current, end);
+	}
+
+	template<typename ISA>
+	static const char* SkipWordSIMD(const char* current, const char* end)
+	{
+		while (end - current >= ISA::WIDTH)
+		{
+			const uint32_t stops = ~ISA::Alpha(ISA::Load(current)) & ISA::ALL;
+			RETURN_V_IF(current + std::countr_zero(stops), stops != 0);
+
+			current = current + ISA::WIDTH;
+		}
+
+		return SkipWordScalar(current, end);
+	}
+
+	template<typename ISA>
+	static const char* FindCommentEndSIMD(const char* current, const char* end)
+	{
+		while (end - current >= ISA::WIDTH)
+		{
+			const typename ISA::Vec bytes = ISA::Load(current);
+			const uint32_t stops = ISA::Equals(bytes, '#') | ISA::Equals(bytes, '"');
+			RETURN_V_IF(current + std::countr_zero(stops), stops != 0);
+
+			current = current + ISA::WIDTH;
+		}
+
+		return FindCommentEndScalar(current, end);
+	}
+
+	template<typename ISA>
+	static const char* FindStringEndSIMD(const char* current, const char* end)
+	{
+		while (end - current >= ISA::WIDTH)
+		{
+			const uint32_t stops = ISA::Equals(ISA::Load(current), '"');
+			RETURN_V_IF(current + std::countr_zero(stops), stops != 0);
+
+			current = current + ISA::WIDTH;
+		}
+
+		return FindStringEndScalar(current, end);
+	}
+
+	// Sources are almost all ASCII so whole vectors of it are skipped at once //
+	// Only the characters that are not ASCII are checked one by one //
+	template<typename ISA>
+	static const char* ValidateUTF8SIMD(const char* current, const char* end)
+	{
+		while (end - current >= ISA::WIDTH)
+		{
+			const uint32_t nonASCII = ISA::NonASCII(ISA::Load(current));
+			if (nonASCII == 0)
+			{
+				current = current + ISA::WIDTH;
+				continue;
+			}
+
+			// Checks the character that is not ASCII, the bytes before it are //
+			current = current + std::countr_zero(nonASCII);
+
+			const int length = UTF8SequenceLength((const unsigned char*)current, (const unsigned char*)end);
+			RETURN_V_IF(current, length == 0);
+
+			current = current + length;
+		}
+
+		return ValidateUTF8Scalar(current, end);
+	}
+
+	// --- The kernel tables --- //
+
+	const ScanKernels scalarKernels =
+	{
+		SkipWhitespaceScalar,
+		SkipWordScalar,
+		FindCommentEndScalar,
+		FindStringEndScalar,
+		ValidateUTF8Scalar,
+		"Scalar"
+	};
+
+	const ScanKernels sse2Kernels =
+	{
+		SkipWhitespaceSIMD<SSE2>,
+		SkipWordSIMD<SSE2>,
+		FindCommentEndSIMD<SSE2>,
+		FindStringEndSIMD<SSE2>,
+		ValidateUTF8SIMD<SSE2>,
+		"SSE2"
+	};
+
+	const ScanKernels avx2Kernels =
+	{
+		SkipWhitespaceSIMD<AVX2>,
+		SkipWordSIMD<AVX2>,
+		FindCommentEndSIMD<AVX2>,
+		FindStringEndSIMD<AVX2>,
+		ValidateUTF8SIMD<AVX2>,
+		"AVX2"
+	};
+
+	// Uses CPUID to find the best instruction set the CPU (and OS) supports //
+	static const ScanKernels& DetectScanKernels()
+	{
+		int info[4] = {};
+
+		// Leaf 0 holds the highest leaf the CPU supports, leaves above it return whatever the highest one does //
+		__cpuid(info, 0);
+		const int maxLeaf = info[0];
+
+		// Leaf 1 holds the SSE2, AVX and OSXSAVE flags //
+		__cpuid(info, 1);
+		const bool sse2 = (info[3] & (1 << 26)) != 0;
+		const bool avx = (info[2] & (1 << 28)) != 0;
+		const bool osxsave = (info[2] & (1 << 27)) != 0;
+
+		// The OS has to save the YMM registers for AVX to be usable //
+		const bool ymmSaved = osxsave && ((_xgetbv(0) & 0x6) == 0x6);
+
+		// Leaf 7 holds the AVX2 flag (if the CPU has it) //
+		bool avx2 = false;
+		if (maxLeaf >= 7)
+		{
+			__cpuidex(info, 7, 0);
+			avx2 = (info[1] & (1 << 5)) != 0;
+		}
+
+		if (avx && ymmSaved && avx2) { return avx2Kernels; }
+		if (sse2) { return sse2Kernels; }
+		return scalarKernels;
+	}
+
+	const ScanKernels& GetScanKernels()
+	{
+		// Only detects the CPU features once //
+		static const ScanKernels& kernels = DetectScanKernels();
+		return kernels;
+	}
+}
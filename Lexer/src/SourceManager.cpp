@@ -0,0 +1,100 @@
+#include <LX-Common.h>
+
+#include <Lexer.h>
+
+#include <LexerErrors.h>
+
+namespace LX
+{
+	FileID SourceManager::Load(const std::filesystem::path& path, const std::string& errorName)
+	{
+		ScopedEvent event("ReadFile");
+
+		// Maps the file into memory, the entry views into the mapping //
+		std::unique_ptr<FileEntry> entry = std::make_unique<FileEntry>();
+		entry->path = path;
+		entry->mapped = std::make_unique<const SourceFile>(path, errorName);
+		entry->source = entry->mapped->View();
+
+		return AddEntry(std::move(entry));
+	}
+
+	FileID SourceManager::Add(std::string contents, const std::filesystem::path& path)
+	{
+		// Takes ownership of the contents, the entry views into its own copy //
+		std::unique_ptr<FileEntry> entry = std::make_unique<FileEntry>();
+		entry->path = path;
+		entry->owned = std::move(contents);
+		entry->source = entry->owned;
+
+		return AddEntry(std::move(entry));
+	}
+
+	FileID SourceManager::AddEntry(std::unique_ptr<FileEntry> entry)
+	{
+		// Every location of every file has to fit within 32-bits //
+		// The end of the file is given a location as well (so errors can point to it) //
+		ThrowIf<SourceTooLarge>(entry->source.length() >= (size_t)(UINT32_MAX - m_NextStart), entry->path.string());
+
+		entry->start = m_NextStart;
+		m_NextStart = m_NextStart + (uint32_t)entry->source.length() + 1;
+
+		m_Files.push_back(std::move(entry));
+		return (FileID)(m_Files.size() - 1);
+	}
+
+	FileID SourceManager::FileOf(SourceLocation location) const
+	{
+		// Files are given their locations in order so the file is the last one that starts at or before the location //
+		auto it = std::upper_bound(m_Files.begin(), m_Files.end(), location.raw, [](uint32_t raw, const std::unique_ptr<FileEntry>& entry) { return raw < entry->start; });
+		return (FileID)(it - m_Files.begin() - 1);
+	}
+
+	const std::vector<uint32_t>& SourceManager::LineStartsOf(const FileEntry& entry) const
+	{
+		// Only the first call creates the line starts, any others wait for it to finish //
+		std::call_once(entry.lineStartsCreated, [&entry]()
+		{
+			// The first line starts at the beginning of the file and every other one after a new line //
+			entry.lineStarts.push_back(0);
+
+			size_t newLine = entry.source.find('\n');
+			while (newLine != std::string_view::npos)
+			{
+				entry.lineStarts.push_back((uint32_t)newLine + 1);
+				newLine = entry.source.find('\n', newLine + 1);
+			}
+		});
+
+		return entry.lineStarts;
+	}
+
+	ResolvedLocation SourceManager::Resolve(SourceLocation location) const
+	{
+		const FileID file = FileOf(location);
+		const FileEntry& entry = *m_Files[file];
+		const std::vector<uint32_t>& lineStarts = LineStartsOf(entry);
+
+		// Finds the line the location is on, the last one that starts at or before it //
+		const uint32_t index = location.raw - entry.start;
+		const size_t line = std::upper_bound(lineStarts.begin(), lineStarts.end(), index) - lineStarts.begin();
+
+		// Finds the end of the line (the next new line or the end of the file) //
+		const uint32_t lineStart = lineStarts[line - 1];
+		const size_t lineEnd = (line < lineStarts.size()) ? lineStarts[line] - 1 : entry.source.length();
+
+		// Works out the column from the start of the line //
+		// Each character takes up one column however many bytes it is, so the bytes after the first are skipped //
+		// Tabs SHOULD ALWAYS take up 4 spaces //
+		std::streamsize column = 1;
+		for (uint32_t i = lineStart; i < index; i++)
+		{
+			const unsigned char c = (unsigned char)entry.source[i];
+			if ((c & 0xC0) == 0x80) { continue; }
+
+			column = column + ((c == '\t') ? 4 : 1);
+		}
+
+		return { file, (std::streamsize)line, column, entry.source.substr(lineStart, lineEnd - lineStart) };
+	}
+}
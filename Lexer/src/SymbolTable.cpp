@@ -0,0 +1,69 @@
+#include <LX-Common.h>
+
+#include <Lexer.h>
+
+#include <Constants.h>
+
+namespace LX
+{
+	// The size of each block of memory the names are stored in //
+	static constexpr size_t SYMBOL_BLOCK_SIZE = 0x4000;
+
+	SymbolTable::SymbolTable()
+	{
+		// Reserves space for the names of a typical file (stops excess allocations) //
+		m_Names.reserve(256);
+		m_IDs.reserve(256);
+
+		// The keywords are added first so their IDs are their position within the keyword list //
+		for (const Keyword& keyword : keywords)
+		{
+			Intern(keyword.word);
+		}
+	}
+
+	SymbolID SymbolTable::Intern(std::string_view name)
+	{
+		// Returns the ID if the name has already been added //
+		if (auto it = m_IDs.find(name); it != m_IDs.end())
+		{
+			return it->second;
+		}
+
+		// Else gives it the next ID //
+		const SymbolID id = (SymbolID)m_Names.size();
+		const std::string_view stored = Store(name);
+
+		m_Names.push_back(stored);
+		m_IDs.emplace(stored, id);
+		return id;
+	}
+
+	SymbolID SymbolTable::Find(std::string_view name) const
+	{
+		auto it = m_IDs.find(name);
+		return it != m_IDs.end() ? it->second : NO_SYMBOL;
+	}
+
+	std::string_view SymbolTable::Store(std::string_view name)
+	{
+		// Allocates a new block if the name does not fit in the current one //
+		// Names larger than a block get a block of their own //
+		if (name.length() > m_BlockSpace)
+		{
+			const size_t size = std::max(SYMBOL_BLOCK_SIZE, name.length());
+			m_Blocks.push_back(std::make_unique<char[]>(size));
+
+			m_BlockTop = m_Blocks.back().get();
+			m_BlockSpace = size;
+		}
+
+		// Copies the name to the top of the block //
+		std::memcpy(m_BlockTop, name.data(), name.length());
+		const std::string_view stored(m_BlockTop, name.length());
+
+		m_BlockTop = m_BlockTop + name.length();
+		m_BlockSpace = m_BlockSpace - name.length();
+		return stored;
+	}
+}
@@ -2,8 +2,6 @@
 
 #include <Lexer.h>
 
-#include <LexerInfo.h>
-
 namespace LX
 {
 	// Helper macro for the function below //
@@ -73,13 +71,13 @@ namespace LX
 	}
 
 	// Passes the constructor args to the values //
-	Token::Token(const TokenType _type, const LexerInfo& info, std::streamsize _length, const std::string& source)
-		: type(_type), index(info.index - _length + 1), line(info.line), column(info.column - _length), length(_length), contents(source.data() + index, length)
+	Token::Token(const TokenType _type, std::streamsize _index, std::streamsize _length, SourceLocation _location, std::string_view source, SymbolID _symbol)
+		: type(_type), symbol(_symbol), index(_index), length(_length), location(_location), contents(source.data() + index, length)
 	{}
 
 	// This function used to have a use but now it is just a simple getter //
 	// Recommended to use in case of future changes //
-	std::string Token::GetContents() const
+	std::string_view Token::GetContents() const
 	{
 		return contents;
 	}
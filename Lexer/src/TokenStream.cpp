@@ -0,0 +1,36 @@
+#include <LX-Common.h>
+
+#include <Lexer.h>
+
+namespace LX
+{
+	// The average amount of characters in a source for each token (including whitespace and comments) //
+	// Used to estimate how many tokens a source will have before it is lexed //
+	static constexpr size_t AVERAGE_CHARS_PER_TOKEN = 5;
+
+	// Passes constructor args to members //
+	TokenStream::TokenStream(std::string_view source, SourceLocation start)
+		: m_Source(source), m_Start(start)
+	{}
+
+	void TokenStream::ReserveFor(std::streamsize sourceLength)
+	{
+		const size_t estimate = ((size_t)sourceLength / AVERAGE_CHARS_PER_TOKEN) + 1;
+
+		m_Types.reserve(estimate);
+		m_Indices.reserve(estimate);
+		m_Lengths.reserve(estimate);
+		m_Symbols.reserve(estimate);
+	}
+
+	Token TokenStream::At(size_t i) const
+	{
+		return Token(TypeAt(i), IndexAt(i), LengthAt(i), LocationAt(i), m_Source, SymbolAt(i));
+	}
+
+	size_t TokenStream::FindTokenAt(std::streamsize index, size_t from) const
+	{
+		// Tokens are stored in the order they are within the source so they can be binary searched //
+		return std::lower_bound(m_Indices.begin() + from, m_Indices.end(), (uint32_t)index) - m_Indices.begin();
+	}
+}
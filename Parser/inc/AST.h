@@ -10,58 +10,40 @@ namespace LX
 	struct InfoLLVM
 	{
 		// Constructor to initalize them correctly (only constructor available) //
-		InfoLLVM(std::string name);
+		InfoLLVM(std::string name, const SymbolTable& _symbols, const std::unordered_map<SymbolID, const FunctionDefinition*>& _definitions);
+
+		// Returns the IR function of the name, declaring it within the module if it has not been already //
+		// Functions are always declared with external linkage so modules from different threads can be linked together //
+		llvm::Function* GetFunction(SymbolID name);
 
 		llvm::LLVMContext context;
 		llvm::Module module;
 		llvm::IRBuilder<> builder;
 
-		// All IR functions that have been generated //
-		std::unordered_map<std::string, llvm::Function*> functions;
+		// The names of the symbols used within the AST //
+		const SymbolTable& symbols;
+
+		// Every function within the AST, used to find the signatures of the functions to declare //
+		const std::unordered_map<SymbolID, const FunctionDefinition*>& definitions;
+
+		// All IR functions that have been declared within the module //
+		std::unordered_map<SymbolID, llvm::Function*> functions;
 	};
 }
 
 namespace LX::AST
 {
-	class MultiNode : public Node
-	{
-		public:
-			// Constructor to auto set type //
-			MultiNode();
-
-			// Function for generating LLVM IR (Intermediate representation), will throw error if called on this class //
-			llvm::Value* GenIR(InfoLLVM& LLVM, FunctionScope& func) override;
-
-			// Function to log the node to a file, will throw an error if called on this class //
-			void Log(unsigned depth) override;
-
-			// Function to get the node's type name, will throw an error if called on this class //
-			virtual const char* TypeName() override;
-
-			// The nodes that are contained within this node //
-			std::vector<std::unique_ptr<Node>> nodes;
-	};
+	// The members of the nodes are public so passes over the AST (see Visitor.h) can read them //
 
 	// Node to represent any number within the AST //
 	class NumberLiteral : public Node
 	{
 		public:
 			// Constructor to set values and automatically set type //
-			NumberLiteral(std::string num);
-
-			// Function for generating LLVM IR (Intermediate representation) //
-			llvm::Value* GenIR(InfoLLVM& LLVM, FunctionScope& func) override;
-
-			// Function to log the node to a file //
-			void Log(unsigned depth) override;
-
-			// Function to get the node's type name //
-			const char* TypeName() override;
+			NumberLiteral(NumberValue value);
 
-		private:
-			// The number it stores //
-			// Yes the number is stored as a string, It's horrible I know //
-			std::string m_Number;
+			// The number it stores, converted by the lexer //
+			NumberValue m_Value;
 	};
 
 	// Node to represent any 2-sided mathematical or logical operation within the AST //
@@ -69,21 +51,12 @@ namespace LX::AST
 	{
 		public:
 			// Constructor to set values and automatically set type //
-			Operation(std::unique_ptr<Node> lhs, Token::TokenType op, std::unique_ptr<Node> rhs);
+			Operation(Node* lhs, Token::TokenType op, Node* rhs);
 
-			// Function for generating LLVM IR (Intermediate representation) //
-			llvm::Value* GenIR(InfoLLVM& LLVM, FunctionScope& func) override;
-
-			// Function to log the node to a file //
-			void Log(unsigned depth) override;
-
-			// Function to get the node's type name //
-			const char* TypeName() override;
-
-		private:
 			// The sides of the operation //
 			// Unary operations are handled by a different class //
-			std::unique_ptr<Node> m_Lhs, m_Rhs;
+			Node* m_Lhs;
+			Node* m_Rhs;
 
 			// The operation to be applied to the two sides //
 			Token::TokenType m_Operand;
@@ -94,20 +67,10 @@ namespace LX::AST
 	{
 		public:
 			// Constructor to set values and automatically set type //
-			ReturnStatement(std::unique_ptr<Node> val);
-
-			// Function for generating LLVM IR (Intermediate representation) //
-			llvm::Value* GenIR(InfoLLVM& LLVM, FunctionScope& func) override;
+			ReturnStatement(Node* val);
 
-			// Function to log the node to a file //
-			void Log(unsigned depth) override;
-
-			// Function to get the node's type name //
-			const char* TypeName() override;
-
-		private:
 			// What it is returning (can be null) //
-			std::unique_ptr<Node> m_Val;
+			Node* m_Val;
 	};
 
 	// Node to represent the declaration of a variable within the AST //
@@ -115,20 +78,10 @@ namespace LX::AST
 	{
 		public:
 			// Constructor to set values and automatically set type //
-			VariableDeclaration(const std::string& name);
-
-			// Function for generating LLVM IR (Intermediate representation) //
-			llvm::Value* GenIR(InfoLLVM& LLVM, FunctionScope& func) override;
-
-			// Function to log the node to a file //
-			void Log(unsigned depth) override;
-
-			// Function to get the node's type name //
-			const char* TypeName() override;
+			VariableDeclaration(SymbolID name);
 
-		private:
 			// Name of the variable //
-			std::string m_Name;
+			SymbolID m_Name;
 
 			// Doesnt need to store type as everything is currently int //
 	};
@@ -138,23 +91,13 @@ namespace LX::AST
 	{
 		public:
 			// Constructor to set values and automatically set type //
-			VariableAssignment(const std::string& name, std::unique_ptr<AST::Node> val);
+			VariableAssignment(SymbolID name, Node* val);
 
-			// Function for generating LLVM IR (Intermediate representation) //
-			llvm::Value* GenIR(InfoLLVM& LLVM, FunctionScope& func) override;
-
-			// Function to log the node to a file //
-			void Log(unsigned depth) override;
-
-			// Function to get the node's type name //
-			const char* TypeName() override;
-
-		private:
 			// Name of the variable //
-			std::string m_Name;
+			SymbolID m_Name;
 
 			// The value that will be assigned to the value //
-			std::unique_ptr<Node> m_Value;
+			Node* m_Value;
 	};
 
 	// Node to represent accessing a variable within the AST //
@@ -162,20 +105,10 @@ namespace LX::AST
 	{
 		public:
 			// Constructor to set values and automatically set type //
-			VariableAccess(const std::string& name);
-
-			// Function for generating LLVM IR (Intermediate representation) //
-			llvm::Value* GenIR(InfoLLVM& LLVM, FunctionScope& func) override;
+			VariableAccess(SymbolID name);
 
-			// Function to log the node to a file //
-			void Log(unsigned depth) override;
-
-			// Function to get the node's type name //
-			const char* TypeName() override;
-
-		private:
 			// The name of the variable //
-			std::string m_Name;
+			SymbolID m_Name;
 	};
 
 	// Node to represent calling a function within the AST //
@@ -183,22 +116,25 @@ namespace LX::AST
 	{
 		public:
 			// Constructor to set the name of the function and any args it may have //
-			FunctionCall(const std::string& funcName, std::vector<std::unique_ptr<Node>>& args);
-			
-			// Function for generating LLVM IR (Intermediate representation) //
-			llvm::Value* GenIR(InfoLLVM& LLVM, FunctionScope& func) override;
-
-			// Function to log the niode to a file //
-			void Log(unsigned depth) override;
-
-			// Function to get the node's type name //
-			const char* TypeName() override;
+			FunctionCall(SymbolID funcName, std::span<Node*> args);
 
-		private:
 			// The name of the function //
-			std::string m_Name;
+			SymbolID m_Name;
 
-			// Any arguments to pass into the function //
-			std::vector<std::unique_ptr<Node>> m_Args;
+			// Any arguments to pass into the function, the array is within the arena of the FileAST //
+			std::span<Node*> m_Args;
 	};
+
+	// Returns the name of the node's type //
+	const char* TypeName(const Node* node);
+	const char* TypeName(Node::NodeType type);
+
+	// Returns how many nodes there are within the node (including itself) //
+	size_t CountNodes(Node* node);
+
+	// Logs the node (and all the nodes within it) to the log, names are looked up in the symbol table //
+	void LogNode(Node* node, unsigned depth, const SymbolTable& symbols);
+
+	// Generates the LLVM IR (Intermediate representation) of the node //
+	llvm::Value* GenIR(Node* node, InfoLLVM& LLVM, FunctionScope& func);
 }
\ No newline at end of file
@@ -10,12 +10,18 @@ namespace LX
 	// Thrown if there was an error during IR Generation //
 	CREATE_EMPTY_LX_ERROR_TYPE(IRGenerationError);
 
+	// Thrown if there was an error turning the IR into machine code //
+	CREATE_EMPTY_LX_ERROR_TYPE(CodeGenerationError);
+
 	// Error thrown if the user tried to create a variable that already existed //
 	CREATE_EMPTY_LX_ERROR_TYPE(VariableAlreadyExists);
 
 	// Error thrown if user tries to access variable that does not exist //
 	CREATE_EMPTY_LX_ERROR_TYPE(VariableDoesntExist);
 
+	// Thrown if a pass over the AST found a node with a type it does not know (should never happen) //
+	CREATE_EMPTY_LX_ERROR_TYPE(InvalidNodeType);
+
 	// Thrown if there was an unexpected (incorrect) token //
 	struct UnexpectedToken : public RuntimeError
 	{
@@ -27,8 +33,8 @@ namespace LX
 		// Constructor for custom messages in the cmd //
 		UnexpectedToken(Token::TokenType _expected, Token _got, const std::string& message, const ParserInfo& p);
 
-		// The file that the tokens come from //
-		const std::filesystem::path file;
+		// The files being compiled, used to find the file, line and column of the token //
+		const SourceManager& sources;
 
 		// The token type that should be there //
 		const Token::TokenType expected;
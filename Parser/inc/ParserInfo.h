@@ -5,21 +5,33 @@
 // Includes Lexer so it can use LX::Token //
 #include <Lexer.h>
 
+// Includes Parser so it can create the nodes within the arena //
+#include <Parser.h>
+
 namespace LX
 {
 	// Local struct so everything can be public //
 	struct ParserInfo
 	{
 		// Passes constructor args to members //
-		ParserInfo(const std::vector<Token>& _tokens, const std::filesystem::path& path)
-			: tokens(_tokens), index(0), len(_tokens.size()), scopeDepth(0), file(path)
-		{}
-
-		// The file that the tokens were generated from //
-		const std::filesystem::path file;
+		// Reserves space for the statements, arguments and operations (stops excess allocations) //
+		ParserInfo(const TokenStream& _tokens, const SymbolTable& _symbols, const SourceManager& _sources, Arena& _arena)
+			: tokens(_tokens), symbols(_symbols), index(0), len(_tokens.Size()), scopeDepth(0), sources(_sources), arena(_arena), statements{}, args{}, values{}, operators{}
+		{
+			statements.reserve(32);
+			args.reserve(16);
+			values.reserve(16);
+			operators.reserve(16);
+		}
+
+		// The files being compiled, used by errors to find where the tokens are //
+		const SourceManager& sources;
 
 		// Tokens created by the lexer //
-		const std::vector<Token>& tokens;
+		const TokenStream& tokens;
+
+		// The names of the identifiers within the tokens //
+		const SymbolTable& symbols;
 
 		// Length of the the token vector //
 		const size_t len;
@@ -29,5 +41,21 @@ namespace LX
 
 		// Current scope depth //
 		size_t scopeDepth;
+
+		// The arena the nodes are created within //
+		Arena& arena;
+
+		// The statements of the function currently being parsed //
+		// Copied into the arena as a single array once the whole function has been parsed //
+		std::vector<AST::Node*> statements;
+
+		// The arguments of the function calls currently being parsed //
+		// Calls can be nested so each one only uses the arguments it added to the end //
+		std::vector<AST::Node*> args;
+
+		// The values and operators of the operations currently being parsed //
+		// Like the arguments, operations within function calls only use what they added to the end //
+		std::vector<AST::Node*> values;
+		std::vector<Token::TokenType> operators;
 	};
 }
@@ -8,64 +8,36 @@ namespace LX
 {
 	CREATE_EMPTY_LX_ERROR_TYPE(VariableError);
 
+	// Holds the parameters and variables of a function whilst its IR is generated //
+	// Variables are stored in a single open-addressing table keyed by their SymbolID //
+	// Blocks can be nested within the function, variables within a block can shadow ones outside of it //
+	// Variables are kept in registers, the IR is built in SSA form as it is generated (Braun et al. 2013) //
+	// Each basic block remembers the value each variable was last given within it and phis are added on demand //
 	class FunctionScope
 	{
 		public:
-			FunctionScope(const std::vector<std::string> paramNames, llvm::Function* func)
-			{
-				// Counter for the args //
-				unsigned argCounter = 0;
-
-				// Checks the parameter does not exist before inserting //
-				for (const std::string& param : paramNames)
-				{
-					ThrowIf<VariableError>(GetVarLocation(param) != NONE);
+			// Adds the parameters of the function, they are within the same block as the body of the function //
+			// The entry block of the function has to already exist, it is sealed as nothing can jump to it //
+			FunctionScope(const std::vector<SymbolID>& paramNames, llvm::Function* func, InfoLLVM& LLVM);
 
-					// Adds the argument to the map and sets its name //
-					m_Params[param] = func->getArg(argCounter);
-					m_Params[param]->setName(param);
+			// Declares a variable within the current block, it is undefined until it is assigned to //
+			llvm::Value* DecVar(SymbolID name, InfoLLVM& LLVM);
 
-					// Iterates to the next one //
-					argCounter++;
-				}
-			}
+			// Returns the value of a variable or parameter within the current basic block //
+			llvm::Value* AccessVar(SymbolID name, InfoLLVM& LLVM);
 
-			llvm::Value* DecVar(const std::string& name, InfoLLVM& LLVM)
-			{
-				// Finds out if the variable already exists //
-				ThrowIf<VariableError>(GetVarLocation(name) != NONE);
+			// Gives a variable a new value within the current basic block (parameters cannot be assigned to) //
+			llvm::Value* AssignVar(SymbolID name, llvm::Value* value, InfoLLVM& LLVM);
 
-				// Allocates the variable and then returns a pointer to it's allocation //
-				llvm::AllocaInst* inst = LLVM.builder.CreateAlloca(LLVM.builder.getInt32Ty(), nullptr, name);
-				m_LocalVars[name] = inst;
-				return inst;
-			}
-
-			llvm::Value* AccessVar(const std::string& name, InfoLLVM& LLVM)
-			{
-				VariableLocation l = GetVarLocation(name);
+			// Marks that every predecessor of the basic block has been added, finishing the phis within it //
+			// Control flow has to seal each basic block it creates once all the jumps to it have been generated //
+			void SealBlock(llvm::BasicBlock* block);
 
-				switch (l)
-				{
-					case LOCAL:
-						return LLVM.builder.CreateLoad(LLVM.builder.getInt32Ty(), m_LocalVars[name], name + "_v");
+			// Starts a nested block, variables declared within it are removed when it ends //
+			void PushBlock();
 
-					case PARAMS:
-						return m_Params[name];
-
-					default:
-						throw VariableError();
-				}
-			}
-
-			llvm::Value* AssignVar(const std::string& name, AST::Node* value, InfoLLVM& LLVM, FunctionScope& scope)
-			{
-				// Checks it is a local variable and not a parameter //
-				ThrowIf<VariableError>(GetVarLocation(name) != LOCAL);
-				
-				// Returns a pointer to the assignment in the builder //
-				return LLVM.builder.CreateStore(value->GenIR(LLVM, scope), m_LocalVars[name]);
-			}
+			// Ends the current block, the variables it shadowed can be seen again //
+			void PopBlock();
 
 		protected:
 			enum VariableLocation
@@ -75,30 +47,97 @@ namespace LX
 				LOCAL		= 2
 			};
 
-			VariableLocation GetVarLocation(const std::string& name)
+			// A parameter or variable that has been declared //
+			struct Variable
 			{
-				// Searches in the variable maps //
-				auto pIt = m_Params.find(name);
-				auto lIt = m_LocalVars.find(name);
+				SymbolID name;
+				VariableLocation location;
 
-				if (pIt != m_Params.end())
-				{
-					return PARAMS;
-				}
+				// Identifies the variable within the definitions, never reused even when a block ends //
+				uint32_t id;
 
-				if (lIt != m_LocalVars.end())
-				{
-					return LOCAL;
-				}
+				// The block the variable was declared in //
+				uint32_t block;
 
-				return NONE;
-			}
+				// The variable with the same name this one shadows (or NO_VARIABLE) //
+				uint32_t shadowed;
+			};
+
+			// Returns the innermost variable with the name or nullptr if there is none //
+			// The name is only looked up once, the location and value come from the same entry //
+			Variable* Find(SymbolID name);
 
 		private:
-			// Holds the parameters of the functions //
-			std::unordered_map<std::string, llvm::Argument*> m_Params;
+			// Used by the table for names that no variable currently has //
+			static constexpr uint32_t NO_VARIABLE = UINT32_MAX;
+
+			// A slot within the table, names are never removed from the table (only their variable) //
+			struct Slot
+			{
+				SymbolID name = NO_SYMBOL;
+				uint32_t variable = NO_VARIABLE;
+			};
+
+			// Returns the slot of the name, it is empty if the name has never been added //
+			Slot& SlotOf(SymbolID name);
+
+			// Adds the variable within the current block, throwing if it already exists within it //
+			Variable& Declare(SymbolID name, VariableLocation location);
+
+			// --- SSA construction --- //
+
+			// Sets the value of the variable at the end of the basic block so far //
+			void WriteVariable(uint32_t id, llvm::BasicBlock* block, llvm::Value* value);
+
+			// Returns the value of the variable within the basic block //
+			llvm::Value* ReadVariable(uint32_t id, SymbolID name, llvm::BasicBlock* block);
+
+			// Finds the value of the variable from the predecessors of the basic block, adding a phi if needed //
+			llvm::Value* ReadVariableRecursive(uint32_t id, SymbolID name, llvm::BasicBlock* block);
+
+			// Adds a phi to the start of the basic block for the variable //
+			llvm::PHINode* CreatePhi(SymbolID name, llvm::BasicBlock* block);
+
+			// Adds the value of the variable from each predecessor of the basic block of the phi //
+			llvm::Value* AddPhiOperands(uint32_t id, SymbolID name, llvm::PHINode* phi);
+
+			// Removes the phi if it only ever has one value (other than itself), returning what is used instead //
+			llvm::Value* TryRemoveTrivialPhi(llvm::PHINode* phi);
+
+			// The table of every name that has been declared (size is always a power of 2) //
+			std::vector<Slot> m_Slots;
+			size_t m_UsedSlots = 0;
+
+			// Every variable that can currently be seen or is shadowed, in the order they were declared //
+			std::vector<Variable> m_Variables;
+
+			// Where the variables of each nested block start, the block of the function is not included //
+			std::vector<uint32_t> m_Blocks;
+
+			// The ID the next declared variable will get //
+			uint32_t m_NextID = 0;
+
+			// The value of each variable at the end of each basic block so far //
+			// The handles follow the values so phis that are removed are replaced within the definitions //
+			llvm::DenseMap<std::pair<uint32_t, llvm::BasicBlock*>, llvm::WeakTrackingVH> m_Definitions;
+
+			// Basic blocks that all predecessors are known of //
+			llvm::DenseSet<llvm::BasicBlock*> m_SealedBlocks;
+
+			// Phis added to basic blocks before they were sealed, their operands are added when they are //
+			struct IncompletePhi
+			{
+				uint32_t id;
+				SymbolID name;
+				llvm::PHINode* phi;
+			};
+
+			llvm::DenseMap<llvm::BasicBlock*, std::vector<IncompletePhi>> m_IncompletePhis;
+
+			// The type of every variable, only ints are currently supported //
+			llvm::Type* m_Type;
 
-			// Holds all local variables //
-			std::unordered_map<std::string, llvm::AllocaInst*> m_LocalVars;
+			// Used to name the phis after the variables //
+			InfoLLVM& m_LLVM;
 	};
 }
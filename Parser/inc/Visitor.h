@@ -0,0 +1,76 @@
+#pragma once
+
+#include <LX-Common.h>
+
+#include <ParserErrors.h>
+#include <AST.h>
+
+namespace LX::AST
+{
+	// Base of every pass over the AST, calls the Visit function of the derived class for the node's true type //
+	// The derived class must provide a Visit function for every type of node, taking any extra args after the node //
+	// Dispatching is a switch over the type so nodes do not need a v-table pointer, making each one 8 bytes smaller //
+	// It also means a new pass is a single class instead of a virtual function added to every node //
+	template<typename Derived, typename Result>
+	class Visitor
+	{
+		public:
+			// Calls the correct Visit function for the node //
+			template<typename... Args>
+			inline Result Dispatch(Node* node, Args... args)
+			{
+				Derived& self = static_cast<Derived&>(*this);
+
+				switch (node->m_Type)
+				{
+					case Node::NUMBER_LITERAL:
+						return self.Visit(static_cast<NumberLiteral*>(node), args...);
+
+					case Node::OPERATION:
+						return self.Visit(static_cast<Operation*>(node), args...);
+
+					case Node::FUNCTION_CALL:
+						return self.Visit(static_cast<FunctionCall*>(node), args...);
+
+					case Node::VARIABLE_DECLARATION:
+						return self.Visit(static_cast<VariableDeclaration*>(node), args...);
+
+					case Node::VARIABLE_ASSIGNMENT:
+						return self.Visit(static_cast<VariableAssignment*>(node), args...);
+
+					case Node::VARIABLE_ACCESS:
+						return self.Visit(static_cast<VariableAccess*>(node), args...);
+
+					case Node::RETURN_STATEMENT:
+						return self.Visit(static_cast<ReturnStatement*>(node), args...);
+
+					// Every node is created with a valid type so this should never be reached //
+					default:
+						throw InvalidNodeType();
+				}
+			}
+	};
+
+	// Puts a stack shared by the passes on a thread back to the size it was when this was created, even if the pass throws //
+	// Stops a thread that failed a function keeping nodes of an AST that has since been freed //
+	template<typename T>
+	class StackRestorer
+	{
+		public:
+			StackRestorer(std::vector<T>& stack)
+				: m_Stack(stack), m_Start(stack.size())
+			{}
+
+			~StackRestorer()
+			{
+				m_Stack.resize(m_Start);
+			}
+
+			// The size of the stack when this was created //
+			inline size_t Start() const { return m_Start; }
+
+		private:
+			std::vector<T>& m_Stack;
+			const size_t m_Start;
+	};
+}
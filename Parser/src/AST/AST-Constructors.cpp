@@ -7,18 +7,18 @@
 namespace LX
 {
 	// Default constructor that just initalises LLVM variables that it holds //
-	InfoLLVM::InfoLLVM(std::string name)
-		: context{}, builder(context), module(name, context)
+	InfoLLVM::InfoLLVM(std::string name, const SymbolTable& _symbols, const std::unordered_map<SymbolID, const FunctionDefinition*>& _definitions)
+		: context{}, builder(context), module(name, context), symbols(_symbols), definitions(_definitions)
 	{}
 
-	// Reserves space for nodes (stops excess allocations) //
+	// The body is added once it has been parsed //
 	FunctionDefinition::FunctionDefinition()
-		: body{}, name{}
-	{ body.reserve(32); }
+		: body{}, name(NO_SYMBOL)
+	{}
 
 	// Reserves space for functions (stops excess allocations) //
 	FileAST::FileAST()
-		: functions{}
+		: functions{}, arena{}
 	{ functions.reserve(8); }
 }
 
@@ -29,43 +29,38 @@ namespace LX::AST
 		: m_Type(type)
 	{}
 
-	// Automatically sets type //
-	MultiNode::MultiNode()
-		: Node(Node::MULTI_NODE), nodes{}
-	{}
-
 	// Passes constructor args to values and sets type //
-	NumberLiteral::NumberLiteral(std::string num)
-		: Node(Node::NUMBER_LITERAL), m_Number(num)
+	NumberLiteral::NumberLiteral(NumberValue value)
+		: Node(Node::NUMBER_LITERAL), m_Value(value)
 	{}
 
 	// Passes constructor args to values and sets type //
-	Operation::Operation(std::unique_ptr<Node> lhs, Token::TokenType op, std::unique_ptr<Node> rhs)
-		: Node(Node::OPERATION), m_Lhs(std::move(lhs)), m_Operand(op), m_Rhs(std::move(rhs))
+	Operation::Operation(Node* lhs, Token::TokenType op, Node* rhs)
+		: Node(Node::OPERATION), m_Lhs(lhs), m_Operand(op), m_Rhs(rhs)
 	{}
 
 	// Passes constructor args to values and sets type //
-	ReturnStatement::ReturnStatement(std::unique_ptr<Node> val)
-		: Node(Node::RETURN_STATEMENT), m_Val(std::move(val))
+	ReturnStatement::ReturnStatement(Node* val)
+		: Node(Node::RETURN_STATEMENT), m_Val(val)
 	{}
 
 	// Passes constructor args to values and sets type //
-	VariableDeclaration::VariableDeclaration(const std::string& name)
+	VariableDeclaration::VariableDeclaration(SymbolID name)
 		: Node(Node::VARIABLE_DECLARATION), m_Name(name)
 	{}
 
 	// Passes constructor args to values and sets type //
-	VariableAssignment::VariableAssignment(const std::string& name, std::unique_ptr<AST::Node> val)
-		: Node(Node::VARIABLE_ASSIGNMENT), m_Name(name), m_Value(std::move(val))
+	VariableAssignment::VariableAssignment(SymbolID name, Node* val)
+		: Node(Node::VARIABLE_ASSIGNMENT), m_Name(name), m_Value(val)
 	{}
 
 	// Passes constructor args to values and sets type //
-	VariableAccess::VariableAccess(const std::string& name)
+	VariableAccess::VariableAccess(SymbolID name)
 		: Node(Node::VARIABLE_ACCESS), m_Name(name)
 	{}
 
 	// Passes constructor args to values and sets type //
-	FunctionCall::FunctionCall(const std::string& name, std::vector<std::unique_ptr<AST::Node>>& args)
-		: Node(Node::FUNCTION_CALL), m_Name(name), m_Args(std::move(args))
+	FunctionCall::FunctionCall(SymbolID name, std::span<Node*> args)
+		: Node(Node::FUNCTION_CALL), m_Name(name), m_Args(args)
 	{}
 }
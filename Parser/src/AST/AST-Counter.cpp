@@ -0,0 +1,65 @@
+#include <LX-Common.h>
+
+#include <Visitor.h>
+#include <AST.h>
+
+namespace LX::AST
+{
+	// The nodes waiting to be counted, used as a stack //
+	// Shared by every pass on the thread so one is not allocated for each statement //
+	static thread_local std::vector<Node*> s_CountedNodes;
+
+	// Pass that counts the nodes within a node, each visit adds the nodes below it to be counted next //
+	// A stack is used instead of recursion so very deep trees do not overflow the stack //
+	class Counter : public Visitor<Counter, void>
+	{
+		public:
+			void Visit(NumberLiteral* node) {}
+
+			void Visit(Operation* node)
+			{
+				s_CountedNodes.push_back(node->m_Lhs);
+				s_CountedNodes.push_back(node->m_Rhs);
+			}
+
+			void Visit(ReturnStatement* node)
+			{
+				if (node->m_Val != nullptr) { s_CountedNodes.push_back(node->m_Val); }
+			}
+
+			void Visit(VariableDeclaration* node) {}
+
+			void Visit(VariableAssignment* node)
+			{
+				if (node->m_Value != nullptr) { s_CountedNodes.push_back(node->m_Value); }
+			}
+
+			void Visit(VariableAccess* node) {}
+
+			void Visit(FunctionCall* node)
+			{
+				for (Node* arg : node->m_Args) { s_CountedNodes.push_back(arg); }
+			}
+	};
+
+	size_t CountNodes(Node* node)
+	{
+		StackRestorer restore(s_CountedNodes);
+		const size_t first = restore.Start();
+		s_CountedNodes.push_back(node);
+
+		Counter counter;
+		size_t count = 0;
+
+		while (s_CountedNodes.size() > first)
+		{
+			Node* next = s_CountedNodes.back();
+			s_CountedNodes.pop_back();
+
+			counter.Dispatch(next);
+			count++;
+		}
+
+		return count;
+	}
+}
@@ -3,126 +3,170 @@
 #include <Parser.h>
 
 #include <ParserErrors.h>
+#include <Visitor.h>
 #include <Scope.h>
 
 namespace LX::AST
 {
-	// Function for genrating LLVM IR (Intermediate representation), will throw an error if called on this class //
-	llvm::Value* MultiNode::GenIR(InfoLLVM& LLVM, FunctionScope& func)
-	{
-		throw int(); // <- TODO: Make an error type
-	}
-
-	// Function for generating LLVM IR (Intermediate representation) //
-	llvm::Value* NumberLiteral::GenIR(InfoLLVM& LLVM, FunctionScope& func)
-	{
-		// Converts the string to it's int equivalent //
-		// TODO: Support floating point values //
-		int number = std::stoi(m_Number);
-
-		// Returns it as a llvm value (if valid) //
-		// TODO: Support floating point values //
-		// TODO: Make the error actually output information //
-		llvm::Value* out = llvm::ConstantInt::get(llvm::Type::getInt32Ty(LLVM.context), number, true);
-		ThrowIf<IRGenerationError>(out == nullptr);
-		return out;
-	}
-
-	// Function for generating LLVM IR (Intermediate representation) //
-	llvm::Value* Operation::GenIR(InfoLLVM& LLVM, FunctionScope& func)
-	{
-		// Generates the IR for both sides of the operation //
-		llvm::Value* lhs = m_Lhs->GenIR(LLVM, func);
-		llvm::Value* rhs = m_Rhs->GenIR(LLVM, func);
-
-		// If either side is null then return null to prevent invalid IR //
-		// TODO: Make the error actually output information //
-		if (lhs == nullptr || rhs == nullptr)
-		{
-			ThrowIf<IRGenerationError>(true);
-			return nullptr;
-		}
-
-		// Generates the IR of the operation //
-		llvm::Value* out = nullptr;
-
-		// Creates the correct operation depending on the operand //
-		switch (m_Operand)
-		{
-			case Token::ADD:
-				out = LLVM.builder.CreateAdd(lhs, rhs);
-				break;
-
-			case Token::SUB:
-				out = LLVM.builder.CreateSub(lhs, rhs);
-				break;
-
-			case Token::MUL:
-				out = LLVM.builder.CreateMul(lhs, rhs);
-				break;
-
-			case Token::DIV:
-				out = LLVM.builder.CreateSDiv(lhs, rhs);
-				break;
-
-			default:
-				// TODO: Add an error here
-				out = nullptr;
-		}
-		
-		// Checks it all went succesfully before returning //
-		ThrowIf<IRGenerationError>(out == nullptr);
-		return out;
-	}
-
-	// Function for generating LLVM IR (Intermediate representation) //
-	llvm::Value* ReturnStatement::GenIR(InfoLLVM& LLVM, FunctionScope& func)
-	{
-		// Checks if it is a void return //
-		if (m_Val == nullptr)
-		{
-			// Void returns are currently not implemented //
-			// TODO: Find out how to return nothing from a function //
-			ThrowIf<IRGenerationError>(true);
-			return nullptr;
-		}
-
-		// Else it will be returning a value //
-		else
-		{
-			// Generates the value and creates a return for it //
-			// TODO: Make the error actually output information //
-			llvm::Value* out = LLVM.builder.CreateRet(m_Val->GenIR(LLVM, func));
-			ThrowIf<IRGenerationError>(out == nullptr);
-			return out;
-		}
-	}
-
-	// Function for generating LLVM IR (Intermediate representation) //
-	llvm::Value* VariableDeclaration::GenIR(InfoLLVM& LLVM, FunctionScope& func)
-	{
-		return func.DecVar(m_Name, LLVM);
-	}
-
-	llvm::Value* VariableAssignment::GenIR(InfoLLVM& LLVM, FunctionScope& func)
-	{
-		return func.AssignVar(m_Name, m_Value.get(), LLVM, func);
-	}
+	// The operations currently being generated, used as a stack //
+	// Shared by every pass on the thread so one is not allocated for each statement //
+	static thread_local std::vector<Operation*> s_GeneratedOperations;
 
-	llvm::Value* VariableAccess::GenIR(InfoLLVM& LLVM, FunctionScope& func)
+	// Pass that generates the LLVM IR (Intermediate representation) of the nodes within a function //
+	class IRGenerator : public Visitor<IRGenerator, llvm::Value*>
 	{
-		return func.AccessVar(m_Name, LLVM);
-	}
-	
-	llvm::Value* FunctionCall::GenIR(InfoLLVM& LLVM, FunctionScope& func)
+		public:
+			// Passes constructor args to members //
+			IRGenerator(InfoLLVM& LLVM, FunctionScope& func)
+				: m_LLVM(LLVM), m_Func(func)
+			{}
+
+			llvm::Value* Visit(NumberLiteral* node)
+			{
+				// Floating point values are not supported yet so decimals are truncated to an int //
+				// The lexer has already checked ints are within range but decimals can still be too large //
+				int32_t number = node->m_Value.integer;
+				if (node->m_Value.kind == NumberValue::DECIMAL)
+				{
+					ThrowIf<IRGenerationError>(node->m_Value.decimal <= (double)INT32_MIN - 1.0 || node->m_Value.decimal >= (double)INT32_MAX + 1.0);
+					number = (int32_t)node->m_Value.decimal;
+				}
+
+				// Returns it as a llvm value (if valid) //
+				// TODO: Support floating point values //
+				// TODO: Make the error actually output information //
+				llvm::Value* out = llvm::ConstantInt::get(llvm::Type::getInt32Ty(m_LLVM.context), number, true);
+				ThrowIf<IRGenerationError>(out == nullptr);
+				return out;
+			}
+
+			llvm::Value* Visit(Operation* node)
+			{
+				// Finds the bottom of the left side of the operation //
+				// Chains of operations lean to the left so this is done in a loop to stop long chains overflowing the stack //
+				StackRestorer restore(s_GeneratedOperations);
+				const size_t first = restore.Start();
+				Node* bottom = node;
+
+				while (bottom->m_Type == Node::OPERATION)
+				{
+					s_GeneratedOperations.push_back(static_cast<Operation*>(bottom));
+					bottom = static_cast<Operation*>(bottom)->m_Lhs;
+				}
+
+				// Works back up the chain, the left side of each operation is the one that was below it //
+				llvm::Value* lhs = Dispatch(bottom);
+				for (size_t i = s_GeneratedOperations.size(); i > first; i--)
+				{
+					Operation* operation = s_GeneratedOperations[i - 1];
+					lhs = GenOperation(lhs, operation->m_Operand, Dispatch(operation->m_Rhs));
+				}
+
+				return lhs;
+			}
+
+			llvm::Value* Visit(ReturnStatement* node)
+			{
+				// Checks if it is a void return //
+				if (node->m_Val == nullptr)
+				{
+					// Void returns are currently not implemented //
+					// TODO: Find out how to return nothing from a function //
+					ThrowIf<IRGenerationError>(true);
+					return nullptr;
+				}
+
+				// Else it will be returning a value //
+				else
+				{
+					// Generates the value and creates a return for it //
+					// TODO: Make the error actually output information //
+					llvm::Value* out = m_LLVM.builder.CreateRet(Dispatch(node->m_Val));
+					ThrowIf<IRGenerationError>(out == nullptr);
+					return out;
+				}
+			}
+
+			llvm::Value* Visit(VariableDeclaration* node)
+			{
+				return m_Func.DecVar(node->m_Name, m_LLVM);
+			}
+
+			llvm::Value* Visit(VariableAssignment* node)
+			{
+				return m_Func.AssignVar(node->m_Name, Dispatch(node->m_Value), m_LLVM);
+			}
+
+			llvm::Value* Visit(VariableAccess* node)
+			{
+				return m_Func.AccessVar(node->m_Name, m_LLVM);
+			}
+
+			llvm::Value* Visit(FunctionCall* node)
+			{
+				std::vector<llvm::Value*> evaluatedArgs;
+
+				for (Node* arg : node->m_Args)
+				{
+					evaluatedArgs.push_back(Dispatch(arg));
+				}
+
+				return m_LLVM.builder.CreateCall(m_LLVM.GetFunction(node->m_Name), evaluatedArgs, "call_tmp");
+			}
+
+		private:
+			// Generates the IR of a single operation with both sides already generated //
+			llvm::Value* GenOperation(llvm::Value* lhs, Token::TokenType operand, llvm::Value* rhs)
+			{
+				// If either side is null then return null to prevent invalid IR //
+				// TODO: Make the error actually output information //
+				if (lhs == nullptr || rhs == nullptr)
+				{
+					ThrowIf<IRGenerationError>(true);
+					return nullptr;
+				}
+
+				// Generates the IR of the operation //
+				llvm::Value* out = nullptr;
+
+				// Creates the correct operation depending on the operand //
+				switch (operand)
+				{
+					case Token::ADD:
+						out = m_LLVM.builder.CreateAdd(lhs, rhs);
+						break;
+
+					case Token::SUB:
+						out = m_LLVM.builder.CreateSub(lhs, rhs);
+						break;
+
+					case Token::MUL:
+						out = m_LLVM.builder.CreateMul(lhs, rhs);
+						break;
+
+					case Token::DIV:
+						out = m_LLVM.builder.CreateSDiv(lhs, rhs);
+						break;
+
+					default:
+						// TODO: Add an error here
+						out = nullptr;
+				}
+
+				// Checks it all went succesfully before returning //
+				ThrowIf<IRGenerationError>(out == nullptr);
+				return out;
+			}
+
+			// The LLVM objects the IR is generated with //
+			InfoLLVM& m_LLVM;
+
+			// The variables and parameters of the function the nodes are within //
+			FunctionScope& m_Func;
+	};
+
+	llvm::Value* GenIR(Node* node, InfoLLVM& LLVM, FunctionScope& func)
 	{
-		std::vector<llvm::Value*> evaluatedArgs;
-
-		for (std::unique_ptr<Node>& node : m_Args)
-		{
-			evaluatedArgs.push_back(node->GenIR(LLVM, func));
-		}
-
-		return LLVM.builder.CreateCall(LLVM.functions[m_Name], evaluatedArgs, "call_tmp");
+		return IRGenerator(LLVM, func).Dispatch(node);
 	}
 }
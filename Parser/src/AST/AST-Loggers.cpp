@@ -1,114 +1,180 @@
 #include <LX-Common.h>
 
+#include <Visitor.h>
 #include <AST.h>
 
 namespace LX::AST
 {
-	void MultiNode::Log(unsigned depth)
-	{
-		throw int(); // <- TODO: Make an error for this
-	}
-
-	const char* MultiNode::TypeName()
-	{
-		throw int(); // <- TODO: Make an error for this
-	}
-
-	void NumberLiteral::Log(unsigned depth)
-	{
-		Log::out<Log::Priority::HIGH>(std::string(depth, '\t'), "Number: ", m_Number);
-	}
-
-	const char* NumberLiteral::TypeName()
-	{
-		return "Number Literal";
-	}
+	// The operations currently being logged, used as a stack //
+	// Shared by every pass on the thread so one is not allocated for each statement //
+	static thread_local std::vector<Operation*> s_LoggedOperations;
+
+	// Pass that logs every node to the log, the depth is how far the node is indented //
+	class Logger : public Visitor<Logger, void>
+	{
+		public:
+			// Passes constructor args to members //
+			Logger(const SymbolTable& symbols)
+				: m_Symbols(symbols)
+			{}
+
+			void Visit(NumberLiteral* node, unsigned depth)
+			{
+				if constexpr (Log::TRACING)
+				{
+					if (node->m_Value.kind == NumberValue::DECIMAL) { Event({ TraceEventType::NUMBER_DECIMAL, 0, Depth(depth), 0, std::bit_cast<uint64_t>(node->m_Value.decimal) }); }
+					else { Event({ TraceEventType::NUMBER_INTEGER, 0, Depth(depth), 0, (uint64_t)(int64_t)node->m_Value.integer }); }
+				}
+
+				else if (node->m_Value.kind == NumberValue::DECIMAL) { LX_LOG(HIGH, Log::Indent(depth), "Number: ", node->m_Value.decimal); }
+				else { LX_LOG(HIGH, Log::Indent(depth), "Number: ", node->m_Value.integer); }
+			}
+
+			void Visit(Operation* node, unsigned depth)
+			{
+				// Logs the start of every operation down the left side of the chain //
+				// Chains of operations lean to the left so this is done in a loop to stop long chains overflowing the stack //
+				StackRestorer restore(s_LoggedOperations);
+				const size_t first = restore.Start();
+				Node* bottom = node;
+
+				while (bottom->m_Type == Node::OPERATION)
+				{
+					Operation* operation = static_cast<Operation*>(bottom);
+					s_LoggedOperations.push_back(operation);
+
+					if constexpr (Log::TRACING) { Event({ TraceEventType::OPERATION, (uint8_t)operation->m_Operand, Depth(depth) }); }
+					else
+					{
+						LX_LOG(HIGH, Log::Indent(depth), "Operation {", ToString(operation->m_Operand), "}:");
+						LX_LOG(HIGH, Log::Indent(depth + 1), "LHS:");
+					}
+
+					bottom = operation->m_Lhs;
+					depth = depth + 2;
+				}
+
+				Dispatch(bottom, depth);
+
+				// Logs the right side of each operation going back up the chain //
+				for (size_t i = s_LoggedOperations.size(); i > first; i--)
+				{
+					depth = depth - 2;
+
+					if constexpr (Log::TRACING) { Event({ TraceEventType::OPERATION_RHS, 0, Depth(depth) }); }
+					else { LX_LOG(HIGH, Log::Indent(depth + 1), "RHS:"); }
+					Dispatch(s_LoggedOperations[i - 1]->m_Rhs, depth + 2);
+				}
+			}
+
+			void Visit(ReturnStatement* node, unsigned depth)
+			{
+				if constexpr (Log::TRACING) { Event({ TraceEventType::RETURN_STATEMENT, 0, Depth(depth) }); }
+				else { LX_LOG_FORMAT(HIGH, NONE, Log::Indent(depth), "Return"); }
+
+				if (node->m_Val != nullptr)
+				{
+					LX_LOG(LOW, ':');
+					Dispatch(node->m_Val, depth + 1);
+				}
+
+				else
+				{
+					LX_LOG_FORMAT(HIGH, NONE, '\n');
+				}
+			}
+
+			void Visit(VariableDeclaration* node, unsigned depth)
+			{
+				if constexpr (Log::TRACING) { Event({ TraceEventType::VARIABLE_DECLARATION, 0, Depth(depth) }, m_Symbols.NameOf(node->m_Name)); }
+				else { LX_LOG(HIGH, Log::Indent(depth), "Variable declaration: ", m_Symbols.NameOf(node->m_Name)); }
+			}
+
+			void Visit(VariableAssignment* node, unsigned depth)
+			{
+				if constexpr (Log::TRACING) { Event({ TraceEventType::VARIABLE_ASSIGNMENT, 0, Depth(depth) }, m_Symbols.NameOf(node->m_Name)); }
+				else
+				{
+					LX_LOG(HIGH, Log::Indent(depth), "Variable assignment:");
+
+					LX_LOG(HIGH, Log::Indent(depth + 1), "To: ", m_Symbols.NameOf(node->m_Name));
+					LX_LOG(HIGH, Log::Indent(depth + 1), "Value:");
+				}
+
+				Dispatch(node->m_Value, depth + 2);
+			}
+
+			void Visit(VariableAccess* node, unsigned depth)
+			{
+				if constexpr (Log::TRACING) { Event({ TraceEventType::VARIABLE_ACCESS, 0, Depth(depth) }, m_Symbols.NameOf(node->m_Name)); }
+				else { LX_LOG(HIGH, Log::Indent(depth), "Variable: ", m_Symbols.NameOf(node->m_Name)); }
+			}
+
+			void Visit(FunctionCall* node, unsigned depth)
+			{
+				if constexpr (Log::TRACING) { Event({ TraceEventType::FUNCTION_CALL, (uint8_t)(node->m_Args.size() != 0), Depth(depth) }, m_Symbols.NameOf(node->m_Name)); }
+				else { LX_LOG(HIGH, Log::Indent(depth), "Function call{", m_Symbols.NameOf(node->m_Name), "}:"); }
+
+				if (node->m_Args.size() != 0)
+				{
+					if constexpr (Log::TRACING == false) { LX_LOG(HIGH, Log::Indent(depth + 1), "Args:"); }
+
+					for (Node* arg : node->m_Args) { Dispatch(arg, depth + 2); }
+				}
+			}
+
+		private:
+			// Returns the depth stored in a trace event, anything past the most a line is indented by is logged the same //
+			static uint16_t Depth(unsigned depth)
+			{
+				return (uint16_t)std::min(depth, Log::MAX_INDENT);
+			}
+
+			// Records the event of a node into the binary trace //
+			static void Event(const TraceEvent& event) { Log::Event<Log::Priority::HIGH>(event); }
+			static void Event(const TraceEvent& event, std::string_view name) { Log::Event<Log::Priority::HIGH>(event, name); }
+
+			// The names of the symbols within the nodes //
+			const SymbolTable& m_Symbols;
+	};
 
-	void Operation::Log(unsigned depth)
-	{
-		Log::out<Log::Priority::HIGH>(std::string(depth, '\t'), "Operation {", ToString(m_Operand), "}:");
-
-		Log::out<Log::Priority::HIGH>(std::string(depth + 1, '\t'), "LHS:");
-		m_Lhs->Log(depth + 2);
-
-		Log::out<Log::Priority::HIGH>(std::string(depth + 1, '\t'), "RHS:");
-		m_Rhs->Log(depth + 2);
+	void LogNode(Node* node, unsigned depth, const SymbolTable& symbols)
+	{
+		Logger(symbols).Dispatch(node, depth);
 	}
 
-	const char* Operation::TypeName()
+	const char* TypeName(const Node* node)
 	{
-		return "Operation";
+		return TypeName(node->m_Type);
 	}
 
-	void ReturnStatement::Log(unsigned depth)
+	const char* TypeName(Node::NodeType type)
 	{
-		Log::out<Log::Priority::HIGH, Log::Format::NONE>(std::string(depth, '\t'), "Return");
-
-		if (m_Val != nullptr)
+		switch (type)
 		{
-			Log::out(':');
-			m_Val->Log(depth + 1);
-		}
+			case Node::NUMBER_LITERAL:
+				return "Number Literal";
 
-		else
-		{
-			Log::out<Log::Priority::HIGH, Log::Format::NONE>('\n');
-		}
-	}
+			case Node::OPERATION:
+				return "Operation";
 
-	const char* ReturnStatement::TypeName()
-	{
-		return "Return";
-	}
+			case Node::FUNCTION_CALL:
+				return "Function call";
 
-	void VariableDeclaration::Log(unsigned depth)
-	{
-		Log::out<Log::Priority::HIGH>(std::string(depth, '\t'), "Variable declaration: ", m_Name);
-	}
-
-	const char* VariableDeclaration::TypeName()
-	{
-		return "Variable declaration";
-	}
+			case Node::VARIABLE_DECLARATION:
+				return "Variable declaration";
 
-	void VariableAssignment::Log(unsigned depth)
-	{
-		Log::out<Log::Priority::HIGH>(std::string(depth, '\t'), "Variable assignment:");
+			case Node::VARIABLE_ASSIGNMENT:
+				return "Variable assignment";
 
-		Log::out<Log::Priority::HIGH>(std::string(depth + 1, '\t'), "To: ", m_Name);
-		Log::out<Log::Priority::HIGH>(std::string(depth + 1, '\t'), "Value:");
-		m_Value->Log(depth + 2);
-	}
+			case Node::VARIABLE_ACCESS:
+				return "Variable access";
 
-	const char* VariableAssignment::TypeName()
-	{
-		return "Variable assignment";
-	}
-
-	void VariableAccess::Log(unsigned depth)
-	{
-		Log::out<Log::Priority::HIGH>(std::string(depth, '\t'), "Variable: ", m_Name);
-	}
+			case Node::RETURN_STATEMENT:
+				return "Return";
 
-	const char* VariableAccess::TypeName()
-	{
-		return "Variable access";
-	}
-
-	void FunctionCall::Log(unsigned depth)
-	{
-		Log::out<Log::Priority::HIGH>(std::string(depth, '\t'), "Function call{", m_Name, "}:");
-
-		if (m_Args.size() != 0)
-		{
-			Log::out<Log::Priority::HIGH>(std::string(depth + 1, '\t'), "Args:");
-
-			for (auto& arg : m_Args) { arg->Log(depth + 2); }
+			default:
+				return "Undefined";
 		}
 	}
-
-	const char* FunctionCall::TypeName()
-	{
-		return "Function call";
-	}
 }
@@ -0,0 +1,45 @@
+#include <LX-Common.h>
+
+#include <Parser.h>
+
+namespace LX
+{
+	// The size of each block of memory the objects are created in //
+	static constexpr size_t ARENA_BLOCK_SIZE = 0x10000;
+
+	void* Arena::Allocate(size_t size, size_t alignment)
+	{
+		// Works out how many bytes are needed to align the top of the block //
+		size_t padding = (alignment - ((uintptr_t)m_BlockTop & (alignment - 1))) & (alignment - 1);
+
+		// Allocates a new block if it does not fit in the current one //
+		// Anything larger than a block gets a block of its own //
+		if (size + padding > m_BlockSpace)
+		{
+			const size_t blockSize = std::max(ARENA_BLOCK_SIZE, size + alignment);
+			m_Blocks.push_back(std::make_unique_for_overwrite<std::byte[]>(blockSize));
+
+			m_BlockTop = m_Blocks.back().get();
+			m_BlockSpace = blockSize;
+
+			padding = (alignment - ((uintptr_t)m_BlockTop & (alignment - 1))) & (alignment - 1);
+		}
+
+		// Moves the top of the block past the allocation //
+		std::byte* allocation = m_BlockTop + padding;
+		m_BlockTop = allocation + size;
+		m_BlockSpace = m_BlockSpace - (size + padding);
+		return allocation;
+	}
+
+	void Arena::Adopt(Arena& other)
+	{
+		// The blocks are moved so nothing within them moves //
+		// The current block is still used for new allocations as it is tracked by the top and space left //
+		m_Blocks.insert(m_Blocks.end(), std::make_move_iterator(other.m_Blocks.begin()), std::make_move_iterator(other.m_Blocks.end()));
+
+		other.m_Blocks.clear();
+		other.m_BlockTop = nullptr;
+		other.m_BlockSpace = 0;
+	}
+}
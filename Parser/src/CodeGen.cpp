@@ -0,0 +1,134 @@
+#include <LX-Common.h>
+
+#include <Parser.h>
+
+#include <ParserErrors.h>
+
+namespace LX
+{
+	// Modules with fewer functions than this are compiled on a single thread as splitting them would take longer //
+	static constexpr size_t PARALLEL_CODEGEN_THRESHOLD = 64;
+
+	// Creates the target machine of the triple, each thread needs its own as they cannot be shared //
+	static std::unique_ptr<llvm::TargetMachine> CreateTargetMachine(const std::string& triple)
+	{
+		// Finds the target of the triple //
+		// TODO: Make the error actually output information //
+		std::string error;
+		const llvm::Target* target = llvm::TargetRegistry::lookupTarget(triple, error);
+		ThrowIf<CodeGenerationError>(target == nullptr);
+
+		// Uses the same options as llc does by default //
+		return std::unique_ptr<llvm::TargetMachine>(target->createTargetMachine(triple, "generic", "", llvm::TargetOptions(), {}));
+	}
+
+	// Returns the path of the object file of the part //
+	static std::filesystem::path ObjectPath(const std::filesystem::path& objPath, size_t index)
+	{
+		std::filesystem::path out = objPath;
+		out.replace_filename(objPath.stem().string() + "-" + std::to_string(index) + objPath.extension().string());
+		return out;
+	}
+
+	// Compiles the module to an object file //
+	static void EmitObject(llvm::Module& module, const std::filesystem::path& path)
+	{
+		std::unique_ptr<llvm::TargetMachine> machine = CreateTargetMachine(module.getTargetTriple());
+
+		// Opens the object file //
+		std::error_code EC;
+		llvm::raw_fd_ostream file(path.string(), EC);
+		ThrowIf<InvalidFilePath>((bool)EC, "object file path", path);
+
+		// Adds the passes to turn the module into machine code and runs them //
+		// TODO: Make the error actually output information //
+		llvm::legacy::PassManager passes;
+		ThrowIf<CodeGenerationError>(machine->addPassesToEmitFile(passes, file, nullptr, llvm::CGFT_ObjectFile));
+		passes.run(module);
+	}
+
+	std::vector<std::filesystem::path> CompileIR(const std::filesystem::path& IRPath, const std::filesystem::path& objPath, unsigned threads)
+	{
+		// Only the machine the compiler is running on is supported so only it needs to be initalised //
+		static std::once_flag initalised;
+		std::call_once(initalised, []()
+		{
+			llvm::InitializeNativeTarget();
+			llvm::InitializeNativeTargetAsmPrinter();
+		});
+
+		// Reads the IR from the file //
+		// TODO: Make the error actually output information //
+		llvm::LLVMContext context;
+		llvm::SMDiagnostic diagnostic;
+		std::unique_ptr<llvm::Module> module = llvm::parseIRFile(IRPath.string(), diagnostic, context);
+		ThrowIf<CodeGenerationError>(module == nullptr);
+
+		// The IR does not say what it is being compiled for so it uses the machine the compiler is running on //
+		if (module->getTargetTriple().empty())
+		{
+			module->setTargetTriple(llvm::sys::getDefaultTargetTriple());
+		}
+
+		module->setDataLayout(CreateTargetMachine(module->getTargetTriple())->createDataLayout());
+
+		// Small modules are compiled to a single object file //
+		size_t functionCount = 0;
+		for (const llvm::Function& func : *module) { functionCount = functionCount + (func.isDeclaration() == false); }
+
+		if (threads <= 1 || functionCount < PARALLEL_CODEGEN_THRESHOLD)
+		{
+			EmitObject(*module, ObjectPath(objPath, 0));
+			return { ObjectPath(objPath, 0) };
+		}
+
+		// Splits the module into a part for each thread //
+		// A LLVMContext can only be used by one thread at a time so the parts are passed as bitcode to be read into their own //
+		// Functions only seen within the module are made visible to the other parts so they can still be called //
+		LX_LOG(LOW, "Compiling on ", threads, " threads");
+
+		std::vector<llvm::SmallVector<char, 0>> parts;
+		llvm::SplitModule(*module, threads, [&parts](std::unique_ptr<llvm::Module> part)
+		{
+			llvm::raw_svector_ostream stream(parts.emplace_back());
+			llvm::WriteBitcodeToFile(*part, stream);
+		});
+
+		// Compiles each part on its own thread //
+		// Errors are stored so they can be rethrown on this thread //
+		std::vector<std::exception_ptr> errors(parts.size());
+
+		ParallelFor(parts.size(), threads, [&](size_t i)
+		{
+			try
+			{
+				llvm::LLVMContext partContext;
+				llvm::Expected<std::unique_ptr<llvm::Module>> part = llvm::parseBitcodeFile(llvm::MemoryBufferRef(llvm::StringRef(parts[i].data(), parts[i].size()), module->getName()), partContext);
+
+				// TODO: Make the error actually output information //
+				if (!part)
+				{
+					llvm::consumeError(part.takeError());
+					ThrowIf<CodeGenerationError>(true);
+				}
+
+				EmitObject(*part.get(), ObjectPath(objPath, i));
+			}
+
+			catch (...)
+			{
+				errors[i] = std::current_exception();
+			}
+		});
+
+		// Rethrows the first error (if there was one) //
+		std::vector<std::filesystem::path> objects;
+		for (size_t i = 0; i < parts.size(); i++)
+		{
+			if (errors[i] != nullptr) { std::rethrow_exception(errors[i]); }
+			objects.push_back(ObjectPath(objPath, i));
+		}
+
+		return objects;
+	}
+}
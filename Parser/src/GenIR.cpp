@@ -14,9 +14,9 @@ namespace LX
 		return true;
 	}
 
-	static llvm::GlobalValue::LinkageTypes GetLinkageType(const std::string& funcName)
+	static llvm::GlobalValue::LinkageTypes GetLinkageType(SymbolID funcName, const InfoLLVM& LLVM)
 	{
-		if (funcName == "main")
+		if (funcName == LLVM.symbols.Find("main"))
 		{
 			return llvm::Function::ExternalLinkage;
 		}
@@ -27,38 +27,82 @@ namespace LX
 		}
 	}
 
-	// Generates the LLVM IR for the given function //
-	static void GenerateFunctionIR(FunctionDefinition& funcAST, InfoLLVM& LLVM)
+	llvm::Function* InfoLLVM::GetFunction(SymbolID name)
 	{
-		try
+		// Returns the function if it has already been declared //
+		if (auto it = functions.find(name); it != functions.end())
 		{
-			Log::LogNewSection("Generating ", funcAST.name, " LLVM IR");
+			return it->second;
+		}
 
-			// Creates the functions signature and return type //
+		// Else finds its definition to create its signature from //
+		// TODO: Make the error actually output information //
+		auto definition = definitions.find(name);
+		ThrowIf<IRGenerationError>(definition == definitions.end());
 
-			std::vector<llvm::Type*> funcParams(funcAST.params.size(), LLVM.builder.getInt32Ty());
+		// Creates the functions signature and return type //
+		std::vector<llvm::Type*> funcParams(definition->second->params.size(), builder.getInt32Ty());
+		llvm::FunctionType* retType = llvm::FunctionType::get(llvm::Type::getInt32Ty(context), funcParams, false); // <- Defaults to int currently
 
-			llvm::FunctionType* retType = llvm::FunctionType::get(llvm::Type::getInt32Ty(LLVM.context), funcParams, false); // <- Defaults to int currently
-			llvm::Function* func = llvm::Function::Create(retType, GetLinkageType(funcAST.name), funcAST.name, LLVM.module);
-			llvm::BasicBlock* entry = llvm::BasicBlock::Create(LLVM.context, funcAST.name + "-entry", func);
-			LLVM.builder.SetInsertPoint(entry);
+		// Stores the function for other functions to call it //
+		llvm::Function* func = llvm::Function::Create(retType, llvm::Function::ExternalLinkage, symbols.NameOf(name), module);
+		functions[name] = func;
+		return func;
+	}
 
-			// Stores the function for other functions to call it //
+	// Logs the nodes of the function the IR is being generated for //
+	static void LogFunctionIR(const FunctionDefinition& funcAST, const InfoLLVM& LLVM)
+	{
+		LX_LOG_SECTION("Generating ", LLVM.symbols.NameOf(funcAST.name), " LLVM IR");
+
+		// Only goes over the nodes if they are going to be logged //
+		RETURN_IF(Log::IsEnabled<Log::Priority::HIGH>() == false);
 
-			LLVM.functions[funcAST.name] = func;
+		for (AST::Node* node : funcAST.body)
+		{
+			// Binary traces store the type of the node instead of its name //
+			if constexpr (Log::TRACING) { Log::Event<Log::Priority::HIGH>({ TraceEventType::GENERATING_NODE, (uint8_t)node->m_Type }); }
+			else { LX_LOG(HIGH, "Generating: ", AST::TypeName(node)); }
+		}
+	}
+
+	// Adds the timings of a function to the profiler //
+	static void AddFunctionProfile(const FunctionProfile& profile)
+	{
+		RETURN_IF(Profiler::IsEnabled() == false);
+
+		Profiler::AddCount("nodes", profile.nodes);
+		Profiler::AddCount("instructions", profile.instructions);
+		Profiler::AddFunction(profile);
+	}
+
+	// Generates the LLVM IR for the given function, timing it into the profile //
+	static void GenerateFunctionIR(const FunctionDefinition& funcAST, InfoLLVM& LLVM, FunctionProfile& profile)
+	{
+		ScopedEvent event("GenerateFunctionIR", LLVM.symbols.NameOf(funcAST.name));
+
+		try
+		{
+			Timer timer;
+
+			// Gets the declaration of the function, a function can only be given one body //
+			// TODO: Make the error actually output information //
+			llvm::Function* func = LLVM.GetFunction(funcAST.name);
+			ThrowIf<IRGenerationError>(func->empty() == false);
+
+			llvm::BasicBlock* entry = llvm::BasicBlock::Create(LLVM.context, llvm::Twine(LLVM.symbols.NameOf(funcAST.name)) + "-entry", func);
+			LLVM.builder.SetInsertPoint(entry);
 
 			// Creates the storer of the variables/parameters //
 
-			FunctionScope funcScope(funcAST.params, func);
+			FunctionScope funcScope(funcAST.params, func, LLVM);
 
 			// Generates the IR within the function by looping over the nodes //
-			for (auto& node : funcAST.body)
+			for (AST::Node* node : funcAST.body)
 			{
 				ThrowIf<IRGenerationError>(IsValidTopLevelNode(node->m_Type) == false); // <- TODO: replace with actual error type
 
-				Log::out<Log::Priority::HIGH>("Generating: ", node->TypeName());
-
-				node->GenIR(LLVM, funcScope);
+				AST::GenIR(node, LLVM, funcScope);
 			}
 
 			// Adds a terminator if there is none //
@@ -67,34 +111,218 @@ namespace LX
 				LLVM.builder.CreateRet(llvm::ConstantInt::get(llvm::Type::getInt32Ty(LLVM.context), 0, true));
 			}
 
+			profile.buildTime = timer.Restart();
+
 			// Verifies the function works //
 			ThrowIf<IRGenerationError>(llvm::verifyFunction(*func, &llvm::errs())); // <- TODO: Make error type
+
+			profile.verifyTime = timer.Elapsed();
+
+			// Counts what the function contains (only needed for the report) //
+			if (Profiler::IsEnabled())
+			{
+				profile.name = LLVM.symbols.NameOf(funcAST.name);
+				profile.instructions = func->getInstructionCount();
+
+				for (AST::Node* node : funcAST.body) { profile.nodes = profile.nodes + AST::CountNodes(node); }
+			}
 		}
 
 		catch (...)
 		{
-			__debugbreak();
+			// If using a debugger, throws a breakpoint so it can be caught on the thread it happened on //
+			// Otherwise it is passed on to be rethrown on the main thread //
+			if (IsDebuggerPresent())
+			{
+				__debugbreak();
+			}
+
 			throw;
 		}
 	}
 
+	// --- Parallel IR generation --- //
+	// Every function can be generated on its own as long as the functions it calls are declared //
+	// So the functions are split between threads which each have their own LLVM context and module //
+	// The modules are then passed back as bitcode (as modules cannot move between contexts) and linked together in order //
+
+	// Files with fewer functions than this are generated on a single thread as starting the threads would take longer //
+	static constexpr size_t PARALLEL_IR_THRESHOLD = 64;
+
+	// How many units each thread gets, more units balance the work better but each one has its own module to link //
+	static constexpr size_t IR_UNITS_PER_THREAD = 4;
+
+	// Functions next to each other in the AST that are generated within the same module //
+	struct IRUnit
+	{
+		size_t firstFunction;
+		size_t endFunction;
+	};
+
+	// Generates the IR of the functions on multiple threads and links it into the module of the given LLVM objects //
+	static void GenerateInParallel(const FileAST& ast, InfoLLVM& LLVM, const std::string& name, unsigned threads)
+	{
+		// Splits the functions into units with roughly the same amount of statements //
+		const size_t unitCount = std::min<size_t>((size_t)threads * IR_UNITS_PER_THREAD, ast.functions.size());
+
+		size_t totalStatements = 0;
+		for (const FunctionDefinition& func : ast.functions) { totalStatements = totalStatements + func.body.size() + 1; }
+		const size_t statementsPerUnit = totalStatements / unitCount + 1;
+
+		std::vector<IRUnit> units = { { 0, 0 } };
+		size_t unitStatements = 0;
+
+		for (size_t i = 0; i < ast.functions.size(); i++)
+		{
+			if (unitStatements >= statementsPerUnit) { units.push_back({ i, i }); unitStatements = 0; }
+
+			units.back().endFunction = i + 1;
+			unitStatements = unitStatements + ast.functions[i].body.size() + 1;
+		}
+
+		// Generates each unit within its own module on its own thread //
+		// Functions it calls from other units are declared within the module when they are first called //
+		// Errors are stored so they can be rethrown on this thread //
+
+		std::vector<llvm::SmallVector<char, 0>> bitcode(units.size());
+		std::vector<std::exception_ptr> errors(units.size());
+		std::vector<size_t> reached(units.size()); // <- The end of the functions each unit got to (including any it failed on)
+		std::vector<FunctionProfile> profiles(ast.functions.size());
+
+		ParallelFor(units.size(), threads, [&](size_t i)
+		{
+			size_t f = units[i].firstFunction;
+
+			try
+			{
+				InfoLLVM unitLLVM(name, LLVM.symbols, LLVM.definitions);
+
+				for (; f < units[i].endFunction; f++)
+				{
+					GenerateFunctionIR(ast.functions[f], unitLLVM, profiles[f]);
+				}
+
+				reached[i] = f;
+
+				llvm::raw_svector_ostream stream(bitcode[i]);
+				llvm::WriteBitcodeToFile(unitLLVM.module, stream);
+			}
+
+			catch (...)
+			{
+				errors[i] = std::current_exception();
+				reached[i] = std::min(f + 1, units[i].endFunction);
+			}
+		});
+
+		// Logs (and profiles) the functions in order up to the first one that failed //
+		for (size_t i = 0; i < units.size(); i++)
+		{
+			for (size_t f = units[i].firstFunction; f < reached[i]; f++)
+			{
+				LogFunctionIR(ast.functions[f], LLVM);
+				AddFunctionProfile(profiles[f]);
+			}
+
+			// Every function is generated on its own so the first error is the one a single thread would have thrown //
+			if (errors[i] != nullptr) { std::rethrow_exception(errors[i]); }
+		}
+
+		// Links the modules in order, the order of the functions is fixed afterwards //
+		for (const llvm::SmallVector<char, 0>& unitBitcode : bitcode)
+		{
+			llvm::Expected<std::unique_ptr<llvm::Module>> unitModule = llvm::parseBitcodeFile(llvm::MemoryBufferRef(llvm::StringRef(unitBitcode.data(), unitBitcode.size()), name), LLVM.context);
+
+			// TODO: Make the error actually output information //
+			if (!unitModule)
+			{
+				llvm::consumeError(unitModule.takeError());
+				ThrowIf<IRGenerationError>(true);
+			}
+
+			ThrowIf<IRGenerationError>(llvm::Linker::linkModules(LLVM.module, std::move(unitModule.get())));
+		}
+
+		// The linker replaces the declarations with the definitions it links in so the functions are found again //
+		for (auto& [funcName, func] : LLVM.functions)
+		{
+			func = LLVM.module.getFunction(LLVM.symbols.NameOf(funcName));
+		}
+
+		// The linker adds a function the first time it is referenced so one called before it is defined ends up too early //
+		// Moves each function to the end in the order they are within the source, the same order as on a single thread //
+		llvm::Module::FunctionListType& functions = LLVM.module.getFunctionList();
+		for (const FunctionDefinition& func : ast.functions)
+		{
+			functions.splice(functions.end(), functions, LLVM.functions.at(func.name)->getIterator());
+		}
+	}
+
 	// Turns an abstract binary tree into LLVM intermediate representation //
-	void GenerateIR(FileAST& ast, const std::string& name, const std::filesystem::path& IRPath)
+	void GenerateIR(FileAST& ast, const SymbolTable& symbols, const std::string& name, const std::filesystem::path& IRPath, unsigned threads)
 	{
 		// Opens the file to output the IR //
 		std::error_code EC;
 		llvm::raw_fd_ostream file(IRPath.string(), EC);
 
+		// Everything up to printing is timed as generating, including creating the LLVM objects //
+		MemoryTracker::BeginPhase("generate");
+		const int64_t liveBefore = MemoryTracker::Live();
+		Timer timer;
+
+		// Finds every function so they can be declared before they are called //
+		std::unordered_map<SymbolID, const FunctionDefinition*> definitions;
+		for (const FunctionDefinition& func : ast.functions)
+		{
+			definitions.try_emplace(func.name, &func);
+		}
+
 		// Creates the LLVM variables needed for generating IR that are shared between functions //
-		InfoLLVM LLVM(name);
+		InfoLLVM LLVM(name, symbols, definitions);
+
+		// Declares every function before any are generated so functions can call functions defined after them //
+		for (const FunctionDefinition& func : ast.functions)
+		{
+			LLVM.GetFunction(func.name);
+		}
+
+		// Files with lots of functions are split over the threads //
+		if (threads > 1 && ast.functions.size() >= PARALLEL_IR_THRESHOLD)
+		{
+			LX_LOG(LOW, "Generating IR on ", threads, " threads");
+			GenerateInParallel(ast, LLVM, name, threads);
+		}
+
+		// Else loops over the functions to generate their LLVM IR //
+		else
+		{
+			for (const FunctionDefinition& func : ast.functions)
+			{
+				FunctionProfile profile;
 
-		// Loops over the functions to generate their LLVM IR //
-		for (auto& func : ast.functions)
+				LogFunctionIR(func, LLVM);
+				GenerateFunctionIR(func, LLVM, profile);
+				AddFunctionProfile(profile);
+			}
+		}
+
+		// Only main can be seen outside of the module //
+		for (const FunctionDefinition& func : ast.functions)
 		{
-			GenerateFunctionIR(func, LLVM);
+			LLVM.functions[func.name]->setLinkage(GetLinkageType(func.name, LLVM));
 		}
 
-		// Outputs the IR to the output file //
+		Profiler::AddPhase("generate", timer.Restart());
+
+		// What is still allocated is held by the LLVM objects (mostly the module) //
+		if constexpr (MemoryTracker::ENABLED) { Profiler::AddCount("llvm_module_bytes", (uint64_t)std::max<int64_t>(MemoryTracker::Live() - liveBefore, 0)); }
+
+		// Outputs the IR to the output file (flushed within the timer so writing it is included) //
+		MemoryTracker::BeginPhase("print");
+		ScopedTimer printTimer("print");
+		ScopedEvent event("PrintIR");
+
 		LLVM.module.print(file, nullptr);
+		file.flush();
 	}
 }
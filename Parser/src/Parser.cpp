@@ -8,62 +8,84 @@
 
 namespace LX
 {
-	// Util function for working out if a token is a two sided operator //
-	static bool IsTwoSidedOperator(Token::TokenType t)
+	// Creates the table of how tightly each two-sided operator binds to the values either side of it //
+	// Higher binds tighter, anything that is not a two-sided operator is left as 0 //
+	static consteval std::array<uint8_t, Token::FUNCTION + 1> GeneratePrecedenceTable()
 	{
-		switch (t)
-		{
-			case Token::ADD:
-			case Token::SUB:
-			case Token::DIV:
-			case Token::MUL:
-				return true;
+		std::array<uint8_t, Token::FUNCTION + 1> table = {};
 
-			default:
-				return false;
-		}
+		table[Token::ADD] = 1;
+		table[Token::SUB] = 1;
+		table[Token::MUL] = 2;
+		table[Token::DIV] = 2;
+
+		return table;
 	}
 
-	std::unique_ptr<AST::Node> ParseOperation(ParserInfo& p);
+	// The precedence of every type of token, all operators are left-associative //
+	static constexpr std::array<uint8_t, Token::FUNCTION + 1> operatorPrecedence = GeneratePrecedenceTable();
+
+	// Returns the precedence of the token at the index, or 0 if it is not a two-sided operator (or past the end) //
+	static inline uint8_t PrecedenceAt(const ParserInfo& p, size_t index)
+	{
+		RETURN_V_IF(0, index >= p.len);
+
+		const size_t type = (size_t)p.tokens.TypeAt(index);
+		return type < operatorPrecedence.size() ? operatorPrecedence[type] : 0;
+	}
+
+	static AST::Node* ParseOperation(ParserInfo& p);
+
+	// Adds a statement to the body of the function currently being parsed //
+	static void AddStatement(ParserInfo& p, AST::Node* node)
+	{
+		p.statements.push_back(node);
+	}
 
 	// Part of ParsePrimary //
-	static std::unique_ptr<AST::Node> ParseIdentifier(ParserInfo& p)
+	static AST::Node* ParseIdentifier(ParserInfo& p)
 	{
-		if (p.tokens[p.index + 1].type == Token::OPEN_PAREN)
+		if (p.tokens.TypeAt(p.index + 1) == Token::OPEN_PAREN)
 		{
-			std::string funcName = p.tokens[p.index].GetContents();
+			SymbolID funcName = p.tokens.SymbolAt(p.index);
 			p.index = p.index + 2; // Skips over open paren and func name
 
-			std::vector<std::unique_ptr<AST::Node>> args;
+			// The arguments are added to the end of the ones of any calls this one is nested within //
+			const size_t firstArg = p.args.size();
 
 			while (true)
 			{
-				args.push_back(ParseOperation(p));
+				p.args.push_back(ParseOperation(p));
 
-				if (p.tokens[p.index].type == Token::CLOSE_PAREN)
+				if (p.tokens.TypeAt(p.index) == Token::CLOSE_PAREN)
 				{
 					p.index++;
-					return std::make_unique<AST::FunctionCall>(funcName, args);
+
+					// Copies this call's arguments into the arena and removes them from the parser //
+					std::span<AST::Node*> args = p.arena.Copy(p.args.data() + firstArg, p.args.size() - firstArg);
+					p.args.resize(firstArg);
+
+					return p.arena.Create<AST::FunctionCall>(funcName, args);
 				}
 
-				ThrowIf<UnexpectedToken>(p.tokens[p.index].type != Token::COMMA, Token::COMMA, p);
+				ThrowIf<UnexpectedToken>(p.tokens.TypeAt(p.index) != Token::COMMA, Token::COMMA, p);
 				p.index++;
 			}
 		}
 
-		return std::make_unique<AST::VariableAccess>(p.tokens[p.index++].GetContents());
+		return p.arena.Create<AST::VariableAccess>(p.tokens.SymbolAt(p.index++));
 	}
 
 	// Base of the call stack to handle the simplest of tokens //
-	static std::unique_ptr<AST::Node> ParsePrimary(ParserInfo& p)
+	static AST::Node* ParsePrimary(ParserInfo& p)
 	{
 		// There are lots of possible token's that can be here so a switch is used //
-		switch (p.tokens[p.index].type)
+		switch (p.tokens.TypeAt(p.index))
 		{
 			// Number literals just require them to be turned into an AST node //
-			// Note: Number literals are stored as strings because i'm a masochist //
+			// Their values were worked out by the lexer //
 			case Token::NUMBER_LITERAL:
-				return std::make_unique<AST::NumberLiteral>(p.tokens[p.index++].GetContents());
+				return p.arena.Create<AST::NumberLiteral>(p.tokens.NumberAt(p.index++));
 
 			// If an Identifier has got here it means a variable is being accessed //
 			case Token::IDENTIFIER:
@@ -76,44 +98,72 @@ namespace LX
 		}
 	}
 
+	// Combines the top two values on the stack with the operator on the top of the stack //
+	static void ReduceOperation(ParserInfo& p)
+	{
+		AST::Node* rhs = p.values.back();
+		p.values.pop_back();
+
+		p.values.back() = p.arena.Create<AST::Operation>(p.values.back(), p.operators.back(), rhs);
+		p.operators.pop_back();
+	}
+
 	// Handles operations, if it is not currently at an operation goes to ParsePrimary //
-	static std::unique_ptr<AST::Node> ParseOperation(ParserInfo& p)
+	// Uses precedence climbing with the values and operators on stacks instead of recursing for each operator //
+	// Operators on the stack only ever increase in precedence so the stacks never grow past the amount of precedence levels //
+	static AST::Node* ParseOperation(ParserInfo& p)
 	{
 		// Calls down the call stack to either get the left hand side or the node //
-		std::unique_ptr<AST::Node> lhs = ParsePrimary(p);
+		AST::Node* lhs = ParsePrimary(p);
+
+		// If the next token is not an operator the parsed value is returned as it is //
+		RETURN_V_IF(lhs, PrecedenceAt(p, p.index) == 0);
+		ThrowIf<UnexpectedToken>(lhs == nullptr, Token::UNDEFINED, p.tokens.At(p.index - 1), "value", p);
 
-		// If the next token is an operator it means the previously parsed data is the left side of the equation //
-		if (IsTwoSidedOperator(p.tokens[p.index].type))
+		// Function call arguments are operations as well so this one only uses the parts of the stacks above where it started //
+		const size_t firstValue = p.values.size();
+		const size_t firstOperator = p.operators.size();
+		p.values.push_back(lhs);
+
+		// Loops over every operator and the value after it //
+		while (uint8_t precedence = PrecedenceAt(p, p.index))
 		{
-			// Parses the left hand side of the operation //
-			ThrowIf<UnexpectedToken>(lhs == nullptr, Token::UNDEFINED, p.tokens[p.index - 1], "value", p);
+			// Combines any previous operators that bind at least as tightly as this one (making them left-associative) //
+			while (p.operators.size() > firstOperator && operatorPrecedence[p.operators.back()] >= precedence)
+			{
+				ReduceOperation(p);
+			}
 
-			// Stores the operator to pass into the AST node //
-			Token::TokenType op = p.tokens[p.index].type;
+			p.operators.push_back(p.tokens.TypeAt(p.index));
 			p.index++;
 
-			// Parses the right hand of the operation //
-			std::unique_ptr<AST::Node> rhs = ParseOperation(p);
-			ThrowIf<UnexpectedToken>(rhs == nullptr, Token::UNDEFINED, p.tokens[p.index - 1], "value", p);
+			// Parses the value on the right of the operator //
+			AST::Node* rhs = ParsePrimary(p);
+			ThrowIf<UnexpectedToken>(rhs == nullptr, Token::UNDEFINED, p.tokens.At(p.index - 1), "value", p);
+			p.values.push_back(rhs);
+		}
 
-			// Returns an AST node as all of the components combined together //
-			return std::make_unique<AST::Operation>(std::move(lhs), op, std::move(rhs));
+		// Combines what is left on the stacks into a single node //
+		while (p.operators.size() > firstOperator)
+		{
+			ReduceOperation(p);
 		}
 
-		// Else it returns the parsed value //
-		return lhs;
+		AST::Node* out = p.values.back();
+		p.values.resize(firstValue);
+		return out;
 	}
 
 	// Handles return statements, if not calls ParseOperation //
-	static std::unique_ptr<AST::Node> ParseReturn(ParserInfo& p)
+	static AST::Node* ParseReturn(ParserInfo& p)
 	{
 		// Checks if the current token is a return //
-		if (p.tokens[p.index].type == Token::RETURN)
+		if (p.tokens.TypeAt(p.index) == Token::RETURN)
 		{
 			// If so it adds an AST node with the value being returned //
 			// Does not mind if this returns nullptr as that just means nothing was returned //
 			p.index++;
-			return std::make_unique<AST::ReturnStatement>(ParseOperation(p));
+			return p.arena.Create<AST::ReturnStatement>(ParseOperation(p));
 		}
 
 		// Else goes down the call stack //
@@ -121,38 +171,35 @@ namespace LX
 	}
 
 	// Handles variable declarations, if not calls ParseReturn //
-	static std::unique_ptr<AST::Node> ParseVarDeclaration(ParserInfo& p)
+	static AST::Node* ParseVarDeclaration(ParserInfo& p)
 	{
 		// Checks if the current token is a declaration //
-		if (p.tokens[p.index].type == Token::INT_DEC)
+		if (p.tokens.TypeAt(p.index) == Token::INT_DEC)
 		{
 			// Skips over the dec token //
 			p.index++;
 
 			// Checks for the variable name //
-			ThrowIf<UnexpectedToken>(p.tokens[p.index].type != Token::IDENTIFIER, Token::IDENTIFIER, p);
-			std::string name = p.tokens[p.index].GetContents();
+			ThrowIf<UnexpectedToken>(p.tokens.TypeAt(p.index) != Token::IDENTIFIER, Token::IDENTIFIER, p);
+			SymbolID name = p.tokens.SymbolAt(p.index);
 			p.index++; // <- Goes over the identifier token
 
 			// Returns the declaration if there is no default assignment to the variable // 
-			if (p.tokens[p.index].type != Token::ASSIGN)
+			if (p.tokens.TypeAt(p.index) != Token::ASSIGN)
 			{
 				// Creates the variable name from the contents of the token and returns it //
-				return std::make_unique<AST::VariableDeclaration>(name);
+				return p.arena.Create<AST::VariableDeclaration>(name);
 			}
 
 			p.index++; // Skips over Token::ASSIGN
 
 			// Gets the value to be assigned to the variable //
-			std::unique_ptr<AST::Node> defaultVal = ParseOperation(p);
-			ThrowIf<UnexpectedToken>(defaultVal.get() == nullptr, Token::UNDEFINED, p.tokens[p.index - 1], "value", p);
+			AST::Node* defaultVal = ParseOperation(p);
+			ThrowIf<UnexpectedToken>(defaultVal == nullptr, Token::UNDEFINED, p.tokens.At(p.index - 1), "value", p);
 
-			// Creates a multi-node of the variable creation and assignment //
-			std::unique_ptr<AST::MultiNode> node = std::make_unique<AST::MultiNode>();
-			node->nodes.push_back(std::make_unique<AST::VariableDeclaration>(name));
-			node->nodes.push_back(std::make_unique<AST::VariableAssignment>(name, std::move(defaultVal)));
-
-			return node;
+			// Adds the declaration as its own statement and returns the assignment to go after it //
+			AddStatement(p, p.arena.Create<AST::VariableDeclaration>(name));
+			return p.arena.Create<AST::VariableAssignment>(name, defaultVal);
 		}
 
 		// Else goes down the call stack //
@@ -160,25 +207,25 @@ namespace LX
 	}
 
 	// Handles variable assignments, if not calls ParseVarDeclaration //
-	static std::unique_ptr<AST::Node> ParseVarAssignment(ParserInfo& p)
+	static AST::Node* ParseVarAssignment(ParserInfo& p)
 	{
 		// Checks if the next token is an equals //
 		if (p.index + 1 < p.len) [[likely]]
 		{
-			if (p.tokens[p.index + 1].type == Token::ASSIGN)
+			if (p.tokens.TypeAt(p.index + 1) == Token::ASSIGN)
 			{
 				// Gets the variable that is being assigned too //
-				ThrowIf<UnexpectedToken>(p.tokens[p.index].type != Token::IDENTIFIER, Token::IDENTIFIER, p);
-				std::string name = p.tokens[p.index].GetContents();
+				ThrowIf<UnexpectedToken>(p.tokens.TypeAt(p.index) != Token::IDENTIFIER, Token::IDENTIFIER, p);
+				SymbolID name = p.tokens.SymbolAt(p.index);
 
 				// Skips over the assign token and name of the variable //
 				p.index = p.index + 2;
 
 				// Gets the value that is being assigned //
-				std::unique_ptr<AST::Node> value = ParseOperation(p);
+				AST::Node* value = ParseOperation(p);
 
 				// Returns an AST node of the variable assignment with it's name and value //
-				return std::make_unique<AST::VariableAssignment>(name, std::move(value));
+				return p.arena.Create<AST::VariableAssignment>(name, value);
 			}
 		}
 
@@ -187,112 +234,246 @@ namespace LX
 	}
 	
 	// Helper function to call the top of the Parse-Call-Stack //
-	static inline std::unique_ptr<AST::Node> Parse(ParserInfo& p)
+	static inline AST::Node* Parse(ParserInfo& p)
 	{
 		// Parses the current token //
-		std::unique_ptr<AST::Node> out = ParseVarAssignment(p);
+		AST::Node* out = ParseVarAssignment(p);
 
 		// Checks it is valid before returning //
-		ThrowIf<UnexpectedToken>(out == nullptr, Token::UNDEFINED, p.tokens[p.index - 1], "top level statement", p);
+		ThrowIf<UnexpectedToken>(out == nullptr, Token::UNDEFINED, p.tokens.At(p.index - 1), "top level statement", p);
 		return out;
 	}
 
-	// Turns the tokens of a file into it's abstract syntax tree equivalent //
-	FileAST TurnTokensIntoAbstractSyntaxTree(std::vector<Token>& tokens, const std::filesystem::path& path)
+	// Parses the function starting at the current token, leaves the parser after the closing bracket of its body //
+	static void ParseFunction(ParserInfo& p, FunctionDefinition& func)
 	{
-		// Creates the output storer and the parser //
-		FileAST output;
-		ParserInfo p(tokens, path);
+		// Skips over function token //
+		p.index++;
 
-		// Loops over the tokens and calls the correct parsing function //
-		// Which depends on their type and current state of the parser //
-		while (p.index < p.len)
+		// Assigns the function name //
+		ThrowIf<UnexpectedToken>(p.tokens.TypeAt(p.index) != Token::IDENTIFIER, Token::IDENTIFIER, p);
+		func.name = p.tokens.SymbolAt(p.index++);
+
+		// Checks for opening paren '(' //
+		ThrowIf<UnexpectedToken>(p.tokens.TypeAt(p.index) != Token::OPEN_PAREN, Token::OPEN_PAREN, p);
+		p.index++;
+
+		// Loops over all the parameters of the function //
+		while (p.index < p.len && (p.tokens.TypeAt(p.index) == Token::CLOSE_PAREN) == false)
+		{
+			// Checks for type declaration //
+			ThrowIf<UnexpectedToken>(p.tokens.TypeAt(p.index) != Token::INT_DEC, Token::INT_DEC, p);
+			p.index++;
+
+			// Checks for variable name //
+			ThrowIf<UnexpectedToken>(p.tokens.TypeAt(p.index) != Token::IDENTIFIER, Token::IDENTIFIER, p);
+			SymbolID pName = p.tokens.SymbolAt(p.index);
+			p.index++;
+
+			// Checks for [comma/close paren] to close the variable declaration //
+			bool correctEnd = (p.tokens.TypeAt(p.index) == Token::COMMA) || (p.tokens.TypeAt(p.index) == Token::CLOSE_PAREN);
+			ThrowIf<UnexpectedToken>(correctEnd == false, Token::UNDEFINED, p.tokens.At(p.index), "end of parameters", p);
+
+			// Adds the variable to the current scope //
+			func.params.push_back(pName);
+
+			// Only iterates if not a close paren //
+			if (p.tokens.TypeAt(p.index) != Token::CLOSE_PAREN) { p.index++; }
+		}
+
+		// Skips over close bracket //
+		p.index++;
+
+		// Checks for opening bracket '{' //
+		ThrowIf<UnexpectedToken>(p.tokens.TypeAt(p.index) != Token::OPEN_BRACKET, Token::OPEN_BRACKET, p);
+		p.index++;
+
+		// Loops over the body until it reaches the end //
+		p.statements.clear();
+		while (p.index < p.len && (p.tokens.TypeAt(p.index) == Token::CLOSE_BRACKET && p.scopeDepth == 0) == false)
+		{
+			// Actually parses the function //
+			AddStatement(p, Parse(p));
+		}
+
+		// Copies the body into the arena //
+		func.body = p.arena.Copy(p.statements.data(), p.statements.size());
+
+		// Skips over closing bracket //
+		p.index++;
+	}
+
+	// Logs the AST of the function //
+	static void LogFunction(const FunctionDefinition& func, const SymbolTable& symbols)
+	{
+		LX_LOG_SECTION("AST of: ", symbols.NameOf(func.name));
+
+		// Only goes over the nodes if they are going to be logged //
+		RETURN_IF(Log::IsEnabled<Log::Priority::HIGH>() == false);
+
+		for (AST::Node* node : func.body)
+		{
+			AST::LogNode(node, 0, symbols);
+		}
+	}
+
+	// --- Parallel parsing --- //
+	// Function bodies never depend on each other so each one can be parsed on its own //
+	// A quick scan over the tokens finds where each function starts and ends so they can be split between threads //
+
+	// Files with fewer functions than this are parsed on a single thread as starting the threads would take longer //
+	static constexpr size_t PARALLEL_PARSING_THRESHOLD = 64;
+
+	// How many units each thread gets, more units balance the work better but each one has its own arena //
+	static constexpr size_t PARSING_UNITS_PER_THREAD = 4;
+
+	// Where a function was found by the scan, the end is the token after the closing bracket of its body //
+	struct FunctionSpan
+	{
+		size_t start;
+		size_t end;
+	};
+
+	// Functions next to each other in the source that are parsed in order by one thread //
+	struct ParsingUnit
+	{
+		size_t firstFunction;
+		size_t endFunction;
+	};
+
+	// Finds every function at the top level of the file //
+	// Stops at anything else as a single thread would have to handle it there //
+	static std::vector<FunctionSpan> FindFunctions(const TokenStream& tokens)
+	{
+		std::vector<FunctionSpan> spans;
+		size_t index = 0;
+
+		while (index < tokens.Size() && tokens.TypeAt(index) == Token::FUNCTION)
+		{
+			// Nothing within a body can contain brackets so the first closing bracket is the end of the function //
+			size_t end = index + 1;
+			while (end < tokens.Size() && tokens.TypeAt(end) != Token::CLOSE_BRACKET) { end++; }
+			RETURN_V_IF(spans, end == tokens.Size());
+
+			spans.push_back({ index, end + 1 });
+			index = end + 1;
+		}
+
+		return spans;
+	}
+
+	// Parses the functions on multiple threads, adding them to the output in source order //
+	// Returns the index of the token a single thread should carry on from //
+	static size_t ParseInParallel(const FileTokens& tokens, const SourceManager& sources, FileAST& output, const std::vector<FunctionSpan>& spans, unsigned threads)
+	{
+		// Splits the functions into units with roughly the same amount of tokens //
+		const size_t unitCount = std::min<size_t>((size_t)threads * PARSING_UNITS_PER_THREAD, spans.size());
+		const size_t tokensPerUnit = (spans.back().end - spans.front().start) / unitCount + 1;
+
+		std::vector<ParsingUnit> units = { { 0, 0 } };
+		for (size_t i = 0; i < spans.size(); i++)
+		{
+			if (spans[i].start - spans[units.back().firstFunction].start >= tokensPerUnit) { units.push_back({ i, i }); }
+			units.back().endFunction = i + 1;
+		}
+
+		// Parses each unit on its own thread with its own cursor and arena //
+		// Errors are stored so they can be rethrown on this thread //
+		// A unit stops at the first function that could not be parsed on its own, which is stored as failed //
+
+		std::vector<FunctionDefinition> functions(spans.size());
+		std::vector<Arena> arenas(units.size());
+		std::vector<std::exception_ptr> errors(units.size());
+		std::vector<size_t> failed(units.size(), SIZE_MAX);
+
+		ParallelFor(units.size(), threads, [&](size_t i)
 		{
-			switch (p.tokens[p.index].type)
+			ParserInfo p(tokens.tokens, tokens.symbols, sources, arenas[i]);
+
+			for (size_t f = units[i].firstFunction; f < units[i].endFunction; f++)
 			{
-				// Wow this logic needs to be abstracted into a seperate function //
-				case Token::FUNCTION:
+				try
 				{
-					// Skips over function token //
-					p.index++;
-
-					// Pushes a new function to the vector and gets a reference to it for adding the body //
-					output.functions.emplace_back();
-					FunctionDefinition& func = output.functions.back();
+					p.index = spans[f].start;
+					ParseFunction(p, functions[f]);
+				}
 
-					// Assigns the function name //
-					ThrowIf<UnexpectedToken>(p.tokens[p.index].type != Token::IDENTIFIER, Token::IDENTIFIER, p);
-					func.name = p.tokens[p.index++].GetContents();
+				catch (...)
+				{
+					errors[i] = std::current_exception();
+					failed[i] = f;
+					return;
+				}
 
-					// Logs the start of the AST section //
-					Log::LogNewSection("AST of: ", func.name);
+				// If the function did not end where the scan thought it would, everything after it is parsed on one thread //
+				if (p.index != spans[f].end)
+				{
+					failed[i] = f;
+					return;
+				}
+			}
+		});
 
-					// Checks for opening paren '(' //
-					ThrowIf<UnexpectedToken>(p.tokens[p.index].type != Token::OPEN_PAREN, Token::OPEN_PAREN, p);
-					p.index++;
+		// The output takes ownership of the memory of all of the nodes //
+		for (Arena& arena : arenas)
+		{
+			output.arena.Adopt(arena);
+		}
 
-					// Loops over all the parameters of the function //
-					while (p.index < p.len && (p.tokens[p.index].type == Token::CLOSE_PAREN) == false)
-					{
-						// Checks for type declaration //
-						ThrowIf<UnexpectedToken>(p.tokens[p.index].type != Token::INT_DEC, Token::INT_DEC, p);
-						p.index++;
+		// Adds the functions in order up to the first one that failed //
+		for (size_t i = 0; i < units.size(); i++)
+		{
+			const size_t end = std::min(failed[i], units[i].endFunction);
+			for (size_t f = units[i].firstFunction; f < end; f++)
+			{
+				LogFunction(functions[f], tokens.symbols);
+				output.functions.push_back(std::move(functions[f]));
+			}
 
-						// Checks for variable name //
-						ThrowIf<UnexpectedToken>(p.tokens[p.index].type != Token::IDENTIFIER, Token::IDENTIFIER, p);
-						std::string pName = p.tokens[p.index].contents;
-						p.index++;
+			// Every function before it was parsed the same as it would have been on one thread //
+			// So its error is the same as the one a single thread would have thrown //
+			if (errors[i] != nullptr) { std::rethrow_exception(errors[i]); }
+			RETURN_V_IF(spans[failed[i]].start, failed[i] != SIZE_MAX);
+		}
 
-						// Checks for [comma/close paren] to close the variable declaration //
-						bool correctEnd = (p.tokens[p.index].type == Token::COMMA) || (p.tokens[p.index].type == Token::CLOSE_PAREN);
-						ThrowIf<UnexpectedToken>(correctEnd == false, Token::UNDEFINED, p.tokens[p.index], "end of parameters", p);
+		return spans.back().end;
+	}
 
-						// Adds the variable to the current scope //
-						func.params.push_back(pName);
+	// Turns the tokens of a file into it's abstract syntax tree equivalent //
+	FileAST TurnTokensIntoAbstractSyntaxTree(const FileTokens& tokens, const SourceManager& sources, unsigned threads)
+	{
+		ScopedEvent event("TurnTokensIntoAbstractSyntaxTree");
 
-						// Only iterates if not a close paren //
-						if (p.tokens[p.index].type != Token::CLOSE_PAREN) { p.index++; }
-					}
+		// Creates the output storer and the parser //
+		FileAST output;
+		ParserInfo p(tokens.tokens, tokens.symbols, sources, output.arena);
 
-					// Skips over close bracket //
-					p.index++;
+		// Files with lots of functions are split over the threads //
+		// The parser carries on from wherever that stopped //
+		if (threads > 1)
+		{
+			const std::vector<FunctionSpan> spans = FindFunctions(tokens.tokens);
+			if (spans.size() >= PARALLEL_PARSING_THRESHOLD)
+			{
+				LX_LOG(LOW, "Parsing on ", threads, " threads");
+				p.index = ParseInParallel(tokens, sources, output, spans, threads);
+			}
+		}
 
-					// Checks for opening bracket '{' //
-					ThrowIf<UnexpectedToken>(p.tokens[p.index].type != Token::OPEN_BRACKET, Token::OPEN_BRACKET, p);
-					p.index++;
+		// Loops over the tokens and calls the correct parsing function //
+		// Which depends on their type and current state of the parser //
+		while (p.index < p.len)
+		{
+			switch (p.tokens.TypeAt(p.index))
+			{
+				case Token::FUNCTION:
+				{
+					// Pushes a new function to the vector and parses it //
+					output.functions.emplace_back();
+					ParseFunction(p, output.functions.back());
 
-					// Loops over the body until it reaches the end //
-					while (p.index < p.len && (p.tokens[p.index].type == Token::CLOSE_BRACKET && p.scopeDepth == 0) == false)
-					{
-						// Actually parses the function //
-						std::unique_ptr<AST::Node> node = Parse(p);
-
-						// Expands the node if it contains multiple //
-						if (node->m_Type == AST::Node::MULTI_NODE)
-						{
-							for (std::unique_ptr<AST::Node>& containedNode : ((AST::MultiNode*)node.get())->nodes)
-							{
-								// Logs the node to the log //
-								containedNode->Log(0);
-
-								// Adds it to the vector //
-								func.body.push_back(std::move(containedNode));
-							}
-						}
-
-						// Else adds the singular node to the vector //
-						else
-						{
-							// Logs the node to the log //
-							node->Log(0);
-
-							// Adds it to the vector //
-							func.body.push_back(std::move(node));
-						}
-					}
-
-					// Skips over closing bracket //
-					p.index++;
+					// Logs the AST of the function //
+					LogFunction(output.functions.back(), p.symbols);
 
 					// Goes to the next iteration of the loop //
 					continue;
@@ -301,14 +482,14 @@ namespace LX
 				// Lets the user know there is an error //
 				// TODO: Makes this error actually output useful information //
 				default:
-					std::cout << "UNKNOWN TOKEN FOUND: " << ToString(p.tokens[p.index].type) << std::endl;
+					std::cout << "UNKNOWN TOKEN FOUND: " << ToString(p.tokens.TypeAt(p.index)) << std::endl;
 					return output;
 			}
 		}
 
 		// Logs that AST has finished parsing //
 		// TODO: Make this output the AST in a human-readable form //
-		Log::out("AST length: ", output.functions[0].body.size());
+		LX_LOG(LOW, "AST length: ", output.functions[0].body.size());
 
 		// Returns the output and shrinks all uneccesarry allocated memory
 		output.functions.shrink_to_fit();
@@ -16,34 +16,40 @@ namespace LX
 		return "IR Generation Error";
 	}
 
+	void CodeGenerationError::PrintToConsole() const
+	{
+	}
+
+	const char* CodeGenerationError::ErrorType() const
+	{
+		return "Code Generation Error";
+	}
+
 	// Constructor to set the members of the error //
 	UnexpectedToken::UnexpectedToken(Token::TokenType _expected, const ParserInfo& p)
-		: file(p.file), expected(Token::UNDEFINED), custom(""), got(p.tokens[p.index])
+		: sources(p.sources), expected(Token::UNDEFINED), custom(""), got(p.tokens.At(p.index))
 	{}
 
 	// Constructor for custom messages in the cmd //
 	UnexpectedToken::UnexpectedToken(Token::TokenType _expected, Token _got, const std::string& message, const ParserInfo& p)
-		: file(p.file), expected(_expected), custom(message), got(_got)
+		: sources(p.sources), expected(_expected), custom(message), got(_got)
 	{}
 
 	void UnexpectedToken::PrintToConsole() const
 	{
+		// Works out where the token is //
+		const ResolvedLocation resolved = sources.Resolve(got.location);
+
 		// Calculates the length of the line number in the console so it is formatted correctly //
 		std::ostringstream oss;
-		oss << std::setw(3) << got.line;
+		oss << std::setw(3) << resolved.line;
 		size_t lineNumberWidthInConsole = std::max(oss.str().size(), (size_t)3);
 
-		// Gets the line of the error //
-		// As the file has been closed and the source has been deleted it needs to be reopened //
-
-		std::string fileContents = ReadFileToString(file);
-		std::string line = LX::GetLineAtIndexOf(fileContents, got.index);
-
 		// Prints the error to the console with the relevant info //
 		std::cout << "\n";
 		PrintAsColor<Color::LIGHT_RED>("Error: ");
 		std::cout << "Incorrect syntax in ";
-		PrintAsColor<Color::WHITE>(file.string());
+		PrintAsColor<Color::WHITE>(sources.PathOf(resolved.file).string());
 		std::cout << ", found ";
 		PrintAsColor<Color::WHITE>(LX::ToString(got.type).c_str());
 		std::cout << " expected: ";
@@ -54,9 +60,9 @@ namespace LX
 		std::cout << "\n";
 
 		// Prints the code with the error to the console //
-		std::string errorSquiggle(got.length, '~');
-		std::cout << "Line: " << std::setw(lineNumberWidthInConsole) << got.line << " | " << line << "\n";
-		std::cout << "      " << std::setw(lineNumberWidthInConsole) << "" << " | " << std::setw(got.column) << "";
+		std::string errorSquiggle(CountCodePoints(got.GetContents()), '~');
+		std::cout << "Line: " << std::setw(lineNumberWidthInConsole) << resolved.line << " | " << resolved.lineContents << "\n";
+		std::cout << "      " << std::setw(lineNumberWidthInConsole) << "" << " | " << std::setw(resolved.column - 1) << "";
 		PrintAsColor<Color::LIGHT_RED>(errorSquiggle.c_str());
 		std::cout << "\n";
 	}
@@ -83,4 +89,13 @@ namespace LX
 	{
 		return "Variable Doesn't exist";
 	}
+
+	void InvalidNodeType::PrintToConsole() const
+	{
+	}
+
+	const char* InvalidNodeType::ErrorType() const
+	{
+		return "Invalid Node Type";
+	}
 }
@@ -14,4 +14,279 @@ namespace LX
 	void VariableError::PrintToConsole() const
 	{
 	}
+
+	// How many slots the table starts with, enough for most functions to never grow it //
+	static constexpr size_t INITIAL_SCOPE_SLOTS = 32;
+
+	// Spreads the IDs over the table, IDs next to each other are common so they are multiplied to stop them clustering //
+	static inline size_t HashSymbol(SymbolID name, size_t mask)
+	{
+		return (size_t)(((uint64_t)name * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+	}
+
+	FunctionScope::FunctionScope(const std::vector<SymbolID>& paramNames, llvm::Function* func, InfoLLVM& LLVM)
+		: m_Slots(INITIAL_SCOPE_SLOTS), m_Type(LLVM.builder.getInt32Ty()), m_LLVM(LLVM)
+	{
+		// Nothing can jump to the entry block so all its predecessors are already known //
+		llvm::BasicBlock* entry = &func->getEntryBlock();
+		SealBlock(entry);
+
+		// Adds each argument and sets its name, they are the first value of the parameters //
+		for (unsigned i = 0; i < paramNames.size(); i++)
+		{
+			llvm::Argument* arg = func->getArg(i);
+			arg->setName(LLVM.symbols.NameOf(paramNames[i]));
+
+			WriteVariable(Declare(paramNames[i], PARAMS).id, entry, arg);
+		}
+	}
+
+	llvm::Value* FunctionScope::DecVar(SymbolID name, InfoLLVM& LLVM)
+	{
+		// The variable is undefined until it is assigned to //
+		// Its definition is still written so a variable declared within a loop does not carry over from the last pass //
+		llvm::Value* undef = llvm::UndefValue::get(m_Type);
+		WriteVariable(Declare(name, LOCAL).id, LLVM.builder.GetInsertBlock(), undef);
+		return undef;
+	}
+
+	llvm::Value* FunctionScope::AccessVar(SymbolID name, InfoLLVM& LLVM)
+	{
+		Variable* var = Find(name);
+		ThrowIf<VariableError>(var == nullptr);
+
+		return ReadVariable(var->id, name, LLVM.builder.GetInsertBlock());
+	}
+
+	llvm::Value* FunctionScope::AssignVar(SymbolID name, llvm::Value* value, InfoLLVM& LLVM)
+	{
+		// Checks it is a local variable and not a parameter //
+		Variable* var = Find(name);
+		ThrowIf<VariableError>(var == nullptr || var->location != LOCAL);
+
+		// Names the value after the variable if it is an instruction that has not been named //
+		llvm::Instruction* inst = llvm::dyn_cast_or_null<llvm::Instruction>(value);
+		if (inst != nullptr && inst->hasName() == false && inst->getType()->isVoidTy() == false)
+		{
+			inst->setName(LLVM.symbols.NameOf(name));
+		}
+
+		WriteVariable(var->id, LLVM.builder.GetInsertBlock(), value);
+		return value;
+	}
+
+	void FunctionScope::SealBlock(llvm::BasicBlock* block)
+	{
+		RETURN_IF(m_SealedBlocks.insert(block).second == false);
+
+		// Finishes the phis that were added before the predecessors were known //
+		// The list is moved out first as finishing the phis can add to the map //
+		auto it = m_IncompletePhis.find(block);
+		RETURN_IF(it == m_IncompletePhis.end());
+
+		std::vector<IncompletePhi> incomplete = std::move(it->second);
+		m_IncompletePhis.erase(it);
+
+		for (const IncompletePhi& phi : incomplete)
+		{
+			AddPhiOperands(phi.id, phi.name, phi.phi);
+		}
+	}
+
+	void FunctionScope::PushBlock()
+	{
+		m_Blocks.push_back((uint32_t)m_Variables.size());
+	}
+
+	void FunctionScope::PopBlock()
+	{
+		// The block of the function cannot be ended //
+		ThrowIf<VariableError>(m_Blocks.empty());
+
+		// Removes the variables of the block (newest first) so each name goes back to the one it shadowed //
+		const uint32_t start = m_Blocks.back();
+		m_Blocks.pop_back();
+
+		for (size_t i = m_Variables.size(); i > start; i--)
+		{
+			const Variable& var = m_Variables[i - 1];
+			SlotOf(var.name).variable = var.shadowed;
+		}
+
+		m_Variables.resize(start);
+	}
+
+	FunctionScope::Variable* FunctionScope::Find(SymbolID name)
+	{
+		const Slot& slot = SlotOf(name);
+		RETURN_V_IF(nullptr, slot.variable == NO_VARIABLE);
+
+		return &m_Variables[slot.variable];
+	}
+
+	FunctionScope::Slot& FunctionScope::SlotOf(SymbolID name)
+	{
+		// Goes along the table from where the name hashes to until it finds it or an empty slot //
+		const size_t mask = m_Slots.size() - 1;
+
+		size_t i = HashSymbol(name, mask);
+
+		while (true)
+		{
+			Slot& slot = m_Slots[i];
+			if (slot.name == name || slot.name == NO_SYMBOL) { return slot; }
+
+			i = (i + 1) & mask;
+		}
+	}
+
+	FunctionScope::Variable& FunctionScope::Declare(SymbolID name, VariableLocation location)
+	{
+		// Grows the table to keep it at most half full so probes stay short //
+		if ((m_UsedSlots + 1) * 2 > m_Slots.size())
+		{
+			std::vector<Slot> old = std::move(m_Slots);
+			m_Slots.assign(old.size() * 2, Slot());
+
+			for (const Slot& slot : old)
+			{
+				if (slot.name != NO_SYMBOL) { SlotOf(slot.name) = slot; }
+			}
+		}
+
+		Slot& slot = SlotOf(name);
+		const uint32_t block = (uint32_t)m_Blocks.size();
+
+		// A name can only be declared once within a block but can shadow a name from an outer one //
+		ThrowIf<VariableError>(slot.variable != NO_VARIABLE && m_Variables[slot.variable].block == block);
+
+		if (slot.name == NO_SYMBOL)
+		{
+			slot.name = name;
+			m_UsedSlots++;
+		}
+
+		m_Variables.push_back({ name, location, m_NextID++, block, slot.variable });
+		slot.variable = (uint32_t)(m_Variables.size() - 1);
+		return m_Variables.back();
+	}
+
+	void FunctionScope::WriteVariable(uint32_t id, llvm::BasicBlock* block, llvm::Value* value)
+	{
+		m_Definitions[{ id, block }] = value;
+	}
+
+	llvm::Value* FunctionScope::ReadVariable(uint32_t id, SymbolID name, llvm::BasicBlock* block)
+	{
+		// Uses the value from within the block if it has been given one //
+		auto it = m_Definitions.find({ id, block });
+		if (it != m_Definitions.end() && it->second != nullptr) { return it->second; }
+
+		return ReadVariableRecursive(id, name, block);
+	}
+
+	llvm::Value* FunctionScope::ReadVariableRecursive(uint32_t id, SymbolID name, llvm::BasicBlock* block)
+	{
+		llvm::Value* value = nullptr;
+
+		// Not all predecessors are known so a phi is added that is finished when the block is sealed //
+		if (m_SealedBlocks.contains(block) == false)
+		{
+			llvm::PHINode* phi = CreatePhi(name, block);
+			m_IncompletePhis[block].push_back({ id, name, phi });
+			value = phi;
+		}
+
+		// Blocks with a single predecessor have the same value as it so no phi is needed //
+		else if (llvm::BasicBlock* pred = block->getSinglePredecessor())
+		{
+			value = ReadVariable(id, name, pred);
+		}
+
+		// A block nothing jumps to has no value for the variable //
+		else if (llvm::pred_empty(block))
+		{
+			value = llvm::UndefValue::get(m_Type);
+		}
+
+		// Else the value comes from each predecessor //
+		// The phi is written first so loops back to this block find it instead of going round forever //
+		else
+		{
+			llvm::PHINode* phi = CreatePhi(name, block);
+			WriteVariable(id, block, phi);
+			value = AddPhiOperands(id, name, phi);
+		}
+
+		WriteVariable(id, block, value);
+		return value;
+	}
+
+	llvm::PHINode* FunctionScope::CreatePhi(SymbolID name, llvm::BasicBlock* block)
+	{
+		// Phis have to be at the start of their block //
+		if (block->empty())
+		{
+			return llvm::PHINode::Create(m_Type, 0, m_LLVM.symbols.NameOf(name), block);
+		}
+
+		return llvm::PHINode::Create(m_Type, 0, m_LLVM.symbols.NameOf(name), &block->front());
+	}
+
+	llvm::Value* FunctionScope::AddPhiOperands(uint32_t id, SymbolID name, llvm::PHINode* phi)
+	{
+		for (llvm::BasicBlock* pred : llvm::predecessors(phi->getParent()))
+		{
+			phi->addIncoming(ReadVariable(id, name, pred), pred);
+		}
+
+		return TryRemoveTrivialPhi(phi);
+	}
+
+	llvm::Value* FunctionScope::TryRemoveTrivialPhi(llvm::PHINode* phi)
+	{
+		// Checks if the phi only ever has one value other than itself //
+		llvm::Value* same = nullptr;
+		for (llvm::Value* operand : phi->incoming_values())
+		{
+			if (operand == same || operand == phi) { continue; }
+
+			// The phi merges at least two values so it is needed //
+			RETURN_V_IF(phi, same != nullptr);
+
+			same = operand;
+		}
+
+		// The phi is only used by itself or in a block nothing jumps to //
+		if (same == nullptr)
+		{
+			same = llvm::UndefValue::get(m_Type);
+		}
+
+		// Remembers the other phis that used it as they may now be trivial as well //
+		// Phis within blocks that are not sealed yet are skipped as they do not have all their operands //
+		std::vector<llvm::WeakTrackingVH> users;
+		for (llvm::User* user : phi->users())
+		{
+			llvm::PHINode* userPhi = llvm::dyn_cast<llvm::PHINode>(user);
+			if (userPhi != nullptr && userPhi != phi && m_SealedBlocks.contains(userPhi->getParent()))
+			{
+				users.emplace_back(userPhi);
+			}
+		}
+
+		// Replaces the phi everywhere (including within the definitions) and removes it //
+		phi->replaceAllUsesWith(same);
+		phi->eraseFromParent();
+
+		for (llvm::WeakTrackingVH& user : users)
+		{
+			if (llvm::PHINode* userPhi = llvm::dyn_cast_or_null<llvm::PHINode>(user))
+			{
+				TryRemoveTrivialPhi(userPhi);
+			}
+		}
+
+		return same;
+	}
 }